@@ -0,0 +1,116 @@
+#include <StrideScheduling/StrideScheduling.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+constexpr int SLICE_MS = 10;
+constexpr int WINDOWS = 10;
+constexpr int SLICES_PER_WINDOW = 100;
+constexpr size_t OPERATIONS = 1 << 16;
+
+static const std::vector<int> TENANT_TICKETS = {100, 200, 400, 50};
+
+/**
+ * @brief Runs the tenants for SLICE_MS slices and prints their achieved CPU share against their ticket share.
+ *
+ * Time is simulated: every pick is charged one slice, so the shares reflect the policy only.
+ *
+ * @param mode Stride or lottery selection.
+ */
+static void report_shares(StrideMode mode)
+{
+    StrideScheduling scheduling(mode, 42);
+    uint64_t total_tickets = 0;
+    for (size_t i = 0; i < TENANT_TICKETS.size(); ++i)
+    {
+        auto task = std::make_shared<UnixTask>(static_cast<int>(i), "Tenant");
+        task->set_attribute(TICKETS_ATTRIBUTE, TENANT_TICKETS[i]);
+        scheduling.enqueue(task);
+        total_tickets += TENANT_TICKETS[i];
+    }
+
+    std::cout << scheduling.get_name() << ": cumulative CPU share % (ticket share %), max error in points\n";
+    std::cout << std::left << std::setw(10) << "time ms";
+    for (size_t i = 0; i < TENANT_TICKETS.size(); ++i)
+    {
+        std::ostringstream header;
+        header << "T" << i << " (" << std::fixed << std::setprecision(1)
+               << 100.0 * TENANT_TICKETS[i] / total_tickets << ")";
+        std::cout << std::setw(16) << header.str();
+    }
+    std::cout << "max error\n";
+
+    std::vector<int> ran(TENANT_TICKETS.size(), 0);
+    for (int window = 1; window <= WINDOWS; ++window)
+    {
+        for (int slice = 0; slice < SLICES_PER_WINDOW; ++slice)
+        {
+            auto task = scheduling.pick_next();
+            scheduling.task_ran(*task, std::chrono::milliseconds(SLICE_MS), false);
+            ++ran[static_cast<size_t>(task->get_id())];
+            scheduling.enqueue(task);
+        }
+
+        int slices = window * SLICES_PER_WINDOW;
+        double error = 0;
+        std::cout << std::left << std::setw(10) << slices * SLICE_MS << std::fixed << std::setprecision(2);
+        for (size_t i = 0; i < TENANT_TICKETS.size(); ++i)
+        {
+            double share = 100.0 * ran[i] / slices;
+            error = std::max(error, std::abs(share - 100.0 * TENANT_TICKETS[i] / total_tickets));
+            std::cout << std::setw(16) << share;
+        }
+        std::cout << error << "\n";
+    }
+    std::cout << "\n";
+}
+
+/**
+ * @brief Measures one pick and requeue at a fixed number of runnable tasks.
+ *
+ * @return double Average time per operation in nanoseconds.
+ */
+static double dispatch_cost(StrideMode mode, size_t depth)
+{
+    StrideScheduling scheduling(mode, 42);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> tickets(1, 1000);
+    for (size_t i = 0; i < depth; ++i)
+    {
+        auto task = std::make_shared<UnixTask>(static_cast<int>(i), "Tenant");
+        task->set_attribute(TICKETS_ATTRIBUTE, tickets(random));
+        scheduling.enqueue(task);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < OPERATIONS; ++i)
+    {
+        auto task = scheduling.pick_next();
+        scheduling.task_ran(*task, std::chrono::milliseconds(SLICE_MS), false);
+        scheduling.enqueue(task);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / OPERATIONS;
+}
+
+int main()
+{
+    report_shares(StrideMode::STRIDE);
+    report_shares(StrideMode::LOTTERY);
+
+    std::cout << "Dispatch cost by run queue depth, " << OPERATIONS << " pick+requeue operations (ns/op)\n\n";
+    std::cout << std::left << std::setw(10) << "depth" << std::setw(12) << "stride" << "lottery\n";
+    for (size_t depth : {16, 256, 4096})
+    {
+        std::cout << std::left << std::setw(10) << depth << std::fixed << std::setprecision(1)
+                  << std::setw(12) << dispatch_cost(StrideMode::STRIDE, depth)
+                  << dispatch_cost(StrideMode::LOTTERY, depth) << "\n";
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr size_t CAPACITY = 1024;
+constexpr size_t TASKS = 1 << 20;
+
+/**
+ * @class BenchRing
+ * @brief Sequence-numbered MPMC ring with a configurable field/slot alignment.
+ *
+ * Mirrors the lock-free slot protocol of PosixSharedMemory. With `Align` equal
+ * to alignof(size_t) it reproduces the former layout (indices next to each
+ * other, slots sharing cache lines); with CACHE_LINE it reproduces the padded one.
+ */
+template <size_t Align>
+class BenchRing
+{
+public:
+    BenchRing() : slots_(CAPACITY)
+    {
+        for (size_t i = 0; i < CAPACITY; ++i)
+            slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+
+    bool try_enqueue(const SharedTask& task)
+    {
+        size_t position = rear_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots_[position % CAPACITY];
+            auto diff = static_cast<std::ptrdiff_t>(slot.sequence_.load(std::memory_order_acquire) - position);
+            if (diff == 0)
+            {
+                if (rear_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.task_ = task;
+                    slot.sequence_.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                position = rear_.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool try_dequeue(SharedTask& task)
+    {
+        size_t position = front_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots_[position % CAPACITY];
+            auto diff = static_cast<std::ptrdiff_t>(slot.sequence_.load(std::memory_order_acquire) - (position + 1));
+            if (diff == 0)
+            {
+                if (front_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    task = slot.task_;
+                    slot.sequence_.store(position + CAPACITY, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                position = front_.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(Align) Slot
+    {
+        std::atomic<size_t> sequence_;
+        SharedTask task_;
+    };
+
+    alignas(Align) std::atomic<size_t> rear_{0};
+    alignas(Align) std::atomic<size_t> front_{0};
+    std::vector<Slot> slots_;
+};
+
+/**
+ * @brief Runs `producers` producer threads against one consumer thread.
+ *
+ * @param producers The number of producer threads.
+ * @param enqueue Stores one task, returns false if the queue is full.
+ * @param dequeue Retrieves one task, returns false if the queue is empty.
+ * @return double Throughput in millions of tasks per second.
+ */
+template <typename Enqueue, typename Dequeue>
+static double run(size_t producers, Enqueue enqueue, Dequeue dequeue)
+{
+    const size_t per_producer = TASKS / producers;
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&enqueue, per_producer, p]()
+        {
+            SharedTask task{static_cast<int>(p), 0, "Task", TaskType::UNIX_TASK, false};
+            for (size_t i = 0; i < per_producer; ++i)
+                while (!enqueue(task))
+                    std::this_thread::yield();
+        });
+    }
+
+    SharedTask task;
+    for (size_t taken = 0; taken < per_producer * producers; )
+    {
+        if (dequeue(task))
+            ++taken;
+        else
+            std::this_thread::yield();
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return per_producer * producers / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    std::cout << "False sharing in the lock-free queue layout, " << TASKS << " tasks, capacity " << CAPACITY
+              << ", N producers / 1 consumer (Mtasks/s)\n"
+              << "hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::left << std::setw(12) << "producers" << std::setw(12) << "unpadded"
+              << std::setw(12) << "padded" << std::setw(16) << "PosixSharedMemory" << "\n";
+
+    for (size_t producers : {1, 2, 4, 8})
+    {
+        auto unpadded = std::make_unique<BenchRing<alignof(size_t)>>();
+        auto padded = std::make_unique<BenchRing<CACHE_LINE>>();
+
+        PosixSharedMemory shm("/bench_shm_false_sharing", CAPACITY, QueueMode::LOCK_FREE);
+        shm.create();
+
+        double before = run(producers,
+            [&](const SharedTask& task) { return unpadded->try_enqueue(task); },
+            [&](SharedTask& task) { return unpadded->try_dequeue(task); });
+        double after = run(producers,
+            [&](const SharedTask& task) { return padded->try_enqueue(task); },
+            [&](SharedTask& task) { return padded->try_dequeue(task); });
+        double queue = run(producers,
+            [&](const SharedTask& task) { shm.enqueue(task); return true; },
+            [&](SharedTask& task) { return shm.try_dequeue_bulk(std::span<SharedTask>(&task, 1), 1) == 1; });
+        shm.destroy();
+
+        std::cout << std::left << std::setw(12) << producers << std::fixed << std::setprecision(2)
+                  << std::setw(12) << before << std::setw(12) << after << std::setw(16) << queue << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <Logger/AsyncLogger.hpp>
+#include <Logger/SharedLogChannel.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+constexpr size_t RECORDS = 100000;
+constexpr size_t BURST = LOG_RING_RECORDS / 2;
+constexpr const char* BENCH_LOG_DIR = "bench_logging";
+
+/**
+ * @brief Logs RECORDS state-change messages in bursts that fit into one ring.
+ *
+ * @param logger The logger under test.
+ * @return double Average caller cost in nanoseconds per record.
+ */
+static double run(Logger& logger)
+{
+    const std::string message = "Task 42 changed state from READY to RUNNING";
+    std::chrono::duration<double, std::nano> elapsed{0};
+
+    for (size_t sent = 0; sent < RECORDS; sent += BURST)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < BURST; ++i)
+            logger.log(message);
+        elapsed += std::chrono::steady_clock::now() - start;
+        AsyncLogger::flush();
+    }
+    return elapsed.count() / RECORDS;
+}
+
+int main()
+{
+    std::filesystem::remove_all(BENCH_LOG_DIR);
+    std::cout << "Caller cost of one log record, " << RECORDS << " records (ns/record)\n\n";
+    std::cout << std::left << std::fixed << std::setprecision(1);
+
+    FileLogger file_logger(BENCH_LOG_DIR, "file");
+    std::cout << std::setw(12) << "file" << run(file_logger) << "\n";
+
+    for (auto [name, policy] : {std::pair{"drop", OverflowPolicy::DROP}, std::pair{"block", OverflowPolicy::BLOCK},
+                                std::pair{"count", OverflowPolicy::COUNT}})
+    {
+        AsyncLogger async_logger(BENCH_LOG_DIR, std::string("async_") + name, policy);
+        std::cout << std::setw(12) << std::string("async ") + name << run(async_logger) << "\n";
+    }
+
+    SharedLogger shared_logger(BENCH_LOG_DIR, "shared", OverflowPolicy::BLOCK);
+    std::cout << std::setw(12) << "shared" << run(shared_logger) << "\n";
+
+    std::filesystem::remove_all(BENCH_LOG_DIR);
+    return 0;
+}
\ No newline at end of file
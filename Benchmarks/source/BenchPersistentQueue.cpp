@@ -0,0 +1,63 @@
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+constexpr size_t CAPACITY = 4096;
+constexpr size_t TASKS = 4096;
+constexpr const char* QUEUE_FILE = "bench_persistent_queue.dat";
+
+/**
+ * @brief Enqueues TASKS tasks in batches and drains the queue again.
+ *
+ * @param shm The queue under test, already created.
+ * @param batch The number of tasks per enqueue_bulk call.
+ * @return double Average enqueue cost in microseconds per task.
+ */
+static double run(PosixSharedMemory& shm, size_t batch)
+{
+    std::vector<SharedTask> tasks(batch, SharedTask{0, 0, "add", TaskType::UNIX_TASK, false});
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t sent = 0; sent < TASKS; sent += batch)
+        shm.enqueue_bulk(tasks);
+
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::vector<SharedTask> received(CAPACITY);
+    while (shm.try_dequeue_bulk(received, received.size()) != 0) {}
+    return elapsed.count() / TASKS;
+}
+
+int main()
+{
+    std::cout << "Enqueue cost of the file-backed queue, " << TASKS << " tasks, capacity " << CAPACITY
+              << " (us/task)\n\n";
+    std::cout << std::left << std::setw(8) << "batch" << std::setw(12) << "shm" << std::setw(12) << "none"
+              << std::setw(12) << "periodic" << "per-batch\n";
+
+    for (size_t batch : {1, 16, 256})
+    {
+        std::cout << std::left << std::setw(8) << batch << std::fixed << std::setprecision(2);
+        {
+            PosixSharedMemory shm("/bench_persistent_queue", CAPACITY);
+            shm.create();
+            std::cout << std::setw(12) << run(shm, batch);
+        }
+
+        for (SyncPolicy sync : {SyncPolicy::NONE, SyncPolicy::PERIODIC, SyncPolicy::PER_BATCH})
+        {
+            unlink(QUEUE_FILE);
+            PosixSharedMemory shm("/bench_persistent_queue", QUEUE_FILE, CAPACITY, sync);
+            shm.create();
+            std::cout << std::setw(12) << run(shm, batch);
+        }
+        std::cout << "\n";
+    }
+
+    unlink(QUEUE_FILE);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <PosixSharedHeap/PosixSharedHeap.hpp>
+#include <PosixSharedRunQueue/PosixSharedRunQueue.hpp>
+#include <PriorityScheduling/PriorityScheduling.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr size_t OPERATIONS = 1 << 14;
+
+/**
+ * @brief Measures one dispatch (pick the highest priority task and requeue it) at a fixed queue depth.
+ *
+ * @param depth The number of queued tasks.
+ * @param pick Removes the next task.
+ * @param requeue Puts a task with the given id and priority back.
+ * @return double Average time per dispatch in microseconds.
+ */
+template <typename Pick, typename Requeue>
+static double run(size_t depth, Pick pick, Requeue requeue)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> priority(-20, 19);
+
+    for (size_t i = 0; i < depth; ++i)
+        requeue(static_cast<int>(i), priority(random));
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < OPERATIONS; ++i)
+        requeue(pick(), priority(random));
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    for (size_t i = 0; i < depth; ++i)
+        pick();
+    return elapsed.count() / OPERATIONS;
+}
+
+int main()
+{
+    std::cout << "Priority dispatch cost by queue depth, " << OPERATIONS << " pick+requeue operations (us/op)\n\n";
+    std::cout << std::left << std::setw(10) << "depth" << std::setw(22) << "select_next_task"
+              << std::setw(16) << "PosixSharedHeap" << "PosixSharedRunQueue\n";
+
+    for (size_t depth : {16, 256, 4096, 16384})
+    {
+        PriorityScheduling algorithm;
+        std::vector<std::shared_ptr<GeneralTask>> tasks;
+        double scan = run(depth,
+            [&]()
+            {
+                size_t index = algorithm.select_next_task(tasks);
+                int id = tasks[index]->get_id();
+                tasks.erase(tasks.begin() + static_cast<std::ptrdiff_t>(index));
+                return id;
+            },
+            [&](int id, int priority) { tasks.push_back(std::make_shared<UnixTask>(id, "Task", priority)); });
+
+        PosixSharedHeap heap("/bench_priority_heap", depth + 1);
+        heap.create();
+        double heap_cost = run(depth,
+            [&]() { return heap.dequeue().id_; },
+            [&](int id, int priority) { heap.enqueue(SharedTask{id, priority, "Task", TaskType::UNIX_TASK, false}); });
+        heap.destroy();
+
+        PosixSharedRunQueue queue("/bench_priority_runqueue", depth + 1);
+        queue.create();
+        double queue_cost = run(depth,
+            [&]() { return queue.dequeue().id_; },
+            [&](int id, int priority) { queue.enqueue(SharedTask{id, priority, "Task", TaskType::UNIX_TASK, false}); });
+        queue.destroy();
+
+        std::cout << std::left << std::setw(10) << depth << std::fixed << std::setprecision(3)
+                  << std::setw(22) << scan << std::setw(16) << heap_cost << queue_cost << "\n";
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <PosixSharedLanes/PosixSharedLanes.hpp>
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+constexpr size_t CAPACITY = 1024;
+constexpr size_t TASKS = 1 << 19;
+
+/**
+ * @brief Runs `producers` producer threads against one consumer thread.
+ *
+ * @param producers The number of producer threads.
+ * @param produce Called once per producer thread with the number of tasks to enqueue.
+ * @param consume Retrieves up to the given number of tasks, returns how many it got.
+ * @return double Throughput in millions of tasks per second.
+ */
+template <typename Produce, typename Consume>
+static double run(size_t producers, Produce produce, Consume consume)
+{
+    const size_t per_producer = TASKS / producers;
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p)
+        threads.emplace_back([&produce, per_producer]() { produce(per_producer); });
+
+    for (size_t taken = 0; taken < per_producer * producers; )
+    {
+        size_t got = consume();
+        if (got == 0)
+            std::this_thread::yield();
+        taken += got;
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return per_producer * producers / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    std::cout << "Ingestion scaling with producer count, " << TASKS << " tasks, capacity " << CAPACITY
+              << ", N producers / 1 consumer (Mtasks/s)\n"
+              << "hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::left << std::setw(12) << "producers" << std::setw(12) << "locking"
+              << std::setw(12) << "lock-free" << std::setw(12) << "lanes" << "\n";
+
+    const SharedTask task{1, 0, "Task", TaskType::UNIX_TASK, false};
+    std::vector<SharedTask> buffer(64);
+
+    for (size_t producers : {1, 2, 4, 8})
+    {
+        double results[3];
+        for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE})
+        {
+            PosixSharedMemory shm("/bench_shm_scaling", CAPACITY, mode);
+            shm.create();
+            results[mode == QueueMode::LOCKING ? 0 : 1] = run(producers,
+                [&](size_t count) { for (size_t i = 0; i < count; ++i) shm.enqueue(task); },
+                [&]() { return shm.try_dequeue_bulk(buffer, buffer.size()); });
+            shm.destroy();
+        }
+
+        PosixSharedLanes lanes("/bench_shm_scaling", producers, CAPACITY / producers, LaneMerge::ROUND_ROBIN);
+        lanes.create();
+        results[2] = run(producers,
+            [&](size_t count)
+            {
+                auto producer = lanes.register_producer();
+                for (size_t i = 0; i < count; ++i)
+                    producer.enqueue(task);
+            },
+            [&]() { return lanes.try_dequeue_bulk(buffer, buffer.size()); });
+        lanes.destroy();
+
+        std::cout << std::left << std::setw(12) << producers << std::fixed << std::setprecision(2)
+                  << std::setw(12) << results[0] << std::setw(12) << results[1] << std::setw(12) << results[2] << "\n";
+    }
+    return 0;
+}
\ No newline at end of file
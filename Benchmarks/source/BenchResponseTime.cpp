@@ -0,0 +1,202 @@
+#include <SrptScheduling/SrptScheduling.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr size_t TASKS = 4000;
+constexpr double MEAN_INTERARRIVAL_MS = 30.0;
+constexpr std::chrono::milliseconds QUANTUM(10);
+
+/**
+ * @struct Operation
+ * @brief A kind of request in the mixed workload.
+ */
+struct Operation
+{
+    const char* name_;
+    double share_;
+    int min_ms_;
+    int max_ms_;
+};
+
+static const std::vector<Operation> OPERATIONS = {
+    {"add", 0.55, 1, 3},
+    {"mul", 0.25, 5, 15},
+    {"sub", 0.12, 20, 40},
+    {"render", 0.08, 150, 350}
+};
+
+/**
+ * @class SimulatedTask
+ * @brief A request whose length the scheduler does not know; it runs on simulated time.
+ */
+class SimulatedTask : public UnixTask
+{
+public:
+    SimulatedTask(int id, const std::string& operation, std::chrono::microseconds work)
+        : UnixTask(id, operation), remaining_(work) {}
+
+    bool execute(std::chrono::milliseconds quantum) override
+    {
+        last_run_ = std::min<std::chrono::microseconds>(quantum, remaining_);
+        remaining_ -= last_run_;
+        return remaining_.count() == 0;
+    }
+
+    [[nodiscard]] inline std::chrono::microseconds last_run() const noexcept
+    {
+        return last_run_;
+    }
+
+private:
+    std::chrono::microseconds remaining_;
+    std::chrono::microseconds last_run_{0};
+};
+
+/**
+ * @struct Arrival
+ * @brief One request of the trace.
+ */
+struct Arrival
+{
+    std::chrono::microseconds time_;
+    size_t operation_;
+    std::chrono::microseconds work_;
+};
+
+/**
+ * @brief Builds a Poisson arrival trace of the mixed workload.
+ */
+static std::vector<Arrival> make_trace()
+{
+    std::mt19937 random(42);
+    std::exponential_distribution<double> interarrival(1.0 / MEAN_INTERARRIVAL_MS);
+    std::vector<double> shares;
+    for (const auto& op : OPERATIONS)
+        shares.push_back(op.share_);
+    std::discrete_distribution<size_t> operation(shares.begin(), shares.end());
+
+    std::vector<Arrival> trace;
+    double now_ms = 0;
+    for (size_t i = 0; i < TASKS; ++i)
+    {
+        now_ms += interarrival(random);
+        size_t kind = operation(random);
+        std::uniform_int_distribution<int> work(OPERATIONS[kind].min_ms_ * 1000, OPERATIONS[kind].max_ms_ * 1000);
+        trace.push_back(Arrival{std::chrono::microseconds(static_cast<int64_t>(now_ms * 1000)), kind,
+            std::chrono::microseconds(work(random))});
+    }
+    return trace;
+}
+
+/**
+ * @brief Replays the trace on one simulated processor.
+ *
+ * @param trace The arrivals.
+ * @param enqueue Adds a runnable task.
+ * @param pick Removes the next task to run.
+ * @param ran Reports a run of the picked task.
+ * @return The response time of every request in milliseconds, in trace order.
+ */
+template <typename Enqueue, typename Pick, typename Ran>
+static std::vector<double> replay(const std::vector<Arrival>& trace, Enqueue enqueue, Pick pick, Ran ran)
+{
+    std::vector<double> response(trace.size());
+    std::chrono::microseconds now{0};
+    size_t next = 0;
+    size_t pending = 0;
+
+    while (next < trace.size() || pending > 0)
+    {
+        if (pending == 0 && now < trace[next].time_)
+            now = trace[next].time_;
+        for (; next < trace.size() && trace[next].time_ <= now; ++next, ++pending)
+            enqueue(std::make_shared<SimulatedTask>(static_cast<int>(next), OPERATIONS[trace[next].operation_].name_,
+                trace[next].work_));
+
+        auto task = pick();
+        bool completed = task->execute(QUANTUM);
+        now += task->last_run();
+        ran(task, completed);
+        if (completed)
+        {
+            auto id = static_cast<size_t>(task->get_id());
+            response[id] = std::chrono::duration<double, std::milli>(now - trace[id].time_).count();
+            --pending;
+        }
+        else
+            enqueue(task);
+    }
+    return response;
+}
+
+/**
+ * @brief Prints the mean response time, overall and per operation.
+ */
+static double report(const std::string& name, const std::vector<Arrival>& trace, const std::vector<double>& response)
+{
+    std::map<size_t, std::pair<double, size_t>> by_operation;
+    double total = 0;
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        total += response[i];
+        by_operation[trace[i].operation_].first += response[i];
+        ++by_operation[trace[i].operation_].second;
+    }
+
+    std::vector<double> sorted(response);
+    std::sort(sorted.begin(), sorted.end());
+    double mean = total / static_cast<double>(trace.size());
+
+    std::cout << std::left << std::setw(14) << name << std::fixed << std::setprecision(1) << std::setw(10) << mean
+              << std::setw(10) << sorted[sorted.size() * 99 / 100];
+    for (const auto& [operation, sum] : by_operation)
+        std::cout << std::setw(10) << sum.first / static_cast<double>(sum.second);
+    std::cout << "\n";
+    return mean;
+}
+
+int main()
+{
+    auto trace = make_trace();
+
+    std::cout << "Response time of " << TASKS << " requests, Poisson arrivals every " << MEAN_INTERARRIVAL_MS
+              << " ms on average, " << QUANTUM.count() << " ms quantum (simulated time, ms)\n\n";
+    std::cout << std::left << std::setw(14) << "algorithm" << std::setw(10) << "mean" << std::setw(10) << "p99";
+    for (const auto& op : OPERATIONS)
+        std::cout << std::setw(10) << op.name_;
+    std::cout << "\n";
+
+    std::deque<std::shared_ptr<SimulatedTask>> fifo;
+    auto round_robin = replay(trace,
+        [&](std::shared_ptr<SimulatedTask> task) { fifo.push_back(std::move(task)); },
+        [&]()
+        {
+            auto task = fifo.front();
+            fifo.pop_front();
+            return task;
+        },
+        [](const std::shared_ptr<SimulatedTask>&, bool) {});
+    double round_robin_mean = report("round robin", trace, round_robin);
+
+    SrptScheduling srpt;
+    auto shortest = replay(trace,
+        [&](std::shared_ptr<SimulatedTask> task) { srpt.enqueue(std::move(task)); },
+        [&]() { return std::static_pointer_cast<SimulatedTask>(srpt.pick_next()); },
+        [&](const std::shared_ptr<SimulatedTask>& task, bool completed)
+        {
+            srpt.task_ran(*task, task->last_run(), completed);
+        });
+    double srpt_mean = report("SRPT (EWMA)", trace, shortest);
+
+    std::cout << "\nSRPT reduces the mean response time by " << std::setprecision(1)
+              << 100.0 * (round_robin_mean - srpt_mean) / round_robin_mean << "%\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+constexpr size_t CAPACITY = 4096;
+constexpr size_t TASKS = 1 << 18;
+
+/**
+ * @brief Moves TASKS tasks from one producer thread to one consumer thread.
+ *
+ * @param mode The queue mode under test.
+ * @param batch The number of tasks per operation.
+ * @param bulk True to use enqueue_bulk/dequeue_bulk, false to loop over enqueue/dequeue.
+ * @return double Throughput in millions of tasks per second.
+ */
+static double run(QueueMode mode, size_t batch, bool bulk)
+{
+    PosixSharedMemory shm("/bench_shm_bulk", CAPACITY, mode);
+    shm.create();
+
+    std::vector<SharedTask> tasks(batch, SharedTask{0, 0, "Task", TaskType::UNIX_TASK, false});
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&shm, &tasks, batch, bulk]()
+    {
+        for (size_t sent = 0; sent < TASKS; sent += batch)
+        {
+            if (bulk)
+                shm.enqueue_bulk(tasks);
+            else
+                for (const auto& task : tasks)
+                    shm.enqueue(task);
+        }
+    });
+
+    std::vector<SharedTask> received(batch);
+    for (size_t taken = 0; taken < TASKS; )
+    {
+        if (bulk)
+            taken += shm.dequeue_bulk(received, batch);
+        else
+            for (size_t i = 0; i < batch; ++i, ++taken)
+                received[i] = shm.dequeue();
+    }
+
+    producer.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    shm.destroy();
+
+    return TASKS / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    std::cout << "Shared memory queue throughput, " << TASKS << " tasks, capacity " << CAPACITY
+              << ", 1 producer / 1 consumer (Mtasks/s)\n\n";
+    std::cout << std::left << std::setw(12) << "mode" << std::setw(8) << "batch"
+              << std::setw(12) << "per-item" << std::setw(12) << "bulk" << "speedup\n";
+
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE})
+    {
+        for (size_t batch : {1, 8, 64, 512})
+        {
+            double per_item = run(mode, batch, false);
+            double bulk = run(mode, batch, true);
+            std::cout << std::left << std::setw(12) << (mode == QueueMode::LOCKING ? "locking" : "lock-free")
+                      << std::setw(8) << batch << std::fixed << std::setprecision(2)
+                      << std::setw(12) << per_item << std::setw(12) << bulk
+                      << bulk / per_item << "x\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
+
+#include <cstdint>
+#include <map>
+
+#define CFS_NICE_0_WEIGHT 1024
+#define CFS_MIN_GRANULARITY_MS 4
+
+static const std::string CFS_SCHEDULING = "Completely Fair Scheduling";
+
+/**
+ * @class CfsScheduling
+ * @brief Implements a completely fair scheduler on the virtual runtime of the tasks.
+ *
+ * Like the Linux CFS, the algorithm charges every run to the task's virtual runtime,
+ * scaled by CFS_NICE_0_WEIGHT over the weight of the task's nice value, and always runs
+ * the runnable task with the smallest virtual runtime. Each nice step changes the share
+ * of CPU time by about 10%, so CPU-bound and I/O-bound tasks of equal nice value get the
+ * same time and a task yielding early keeps the lowest virtual runtime.
+ *
+ * @details
+ * - **Run Queue**: Runnable tasks are kept in a red-black tree (std::multimap) keyed by
+ *   virtual runtime; enqueue() and pick_next() are O(log n) and ties run in arrival order.
+ * - **Placement**: A task entering the run queue gets at least the minimum virtual runtime
+ *   of the queue, so new or long-waiting tasks cannot monopolize the processor.
+ * - **Time Slice**: The processor quantum is the scheduling period; it is stretched to
+ *   CFS_MIN_GRANULARITY_MS per runnable task and split in proportion to the weights.
+ * - **Algorithm Name**: The name of the algorithm is returned as "Completely Fair Scheduling".
+ */
+class CfsScheduling : public SchedulingAlgorithm 
+{
+public:
+    /**
+     * @brief Selects the task with the smallest virtual runtime.
+     * 
+     * @param tasks A vector of shared pointers to GeneralTask objects representing the available tasks.
+     * @return The index of the selected task in the input vector.
+     * @throws std::runtime_error if the task list is empty.
+     */
+    size_t select_next_task(const std::vector<std::shared_ptr<GeneralTask>>&) override;
+
+    /**
+     * @brief No-op implementation for updating task priority.
+     * 
+     * The order of the tasks follows from their virtual runtime.
+     * 
+     * @param task A shared pointer to the GeneralTask object (unused in this implementation).
+     */
+    void update_task_priority(std::shared_ptr<GeneralTask>) override {}
+
+    /**
+     * @brief Returns the name of the scheduling algorithm.
+     *
+     * @return A string containing the name of the algorithm: "Completely Fair Scheduling".
+     */
+    [[nodiscard]] inline std::string get_name() const override 
+    { 
+        return CFS_SCHEDULING; 
+    }
+
+    [[nodiscard]] inline bool has_run_queue() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Inserts a task into the tree, moving its virtual runtime up to the minimum of the queue.
+     *
+     * @param task The runnable task.
+     */
+    void enqueue(std::shared_ptr<GeneralTask>) override;
+
+    /**
+     * @brief Removes the task with the smallest virtual runtime.
+     *
+     * @return The task, or nullptr if no task is runnable.
+     */
+    std::shared_ptr<GeneralTask> pick_next() override;
+
+    /**
+     * @brief Computes the share of the scheduling period of a picked task.
+     *
+     * @param task The task returned by pick_next().
+     * @param quantum The scheduling period.
+     * @return The time slice, at least CFS_MIN_GRANULARITY_MS.
+     */
+    std::chrono::milliseconds time_slice(const GeneralTask&, std::chrono::milliseconds) const override;
+
+    /**
+     * @brief Charges a run to the virtual runtime of the task.
+     *
+     * @param task The task.
+     * @param ran The time the task ran.
+     * @param completed Whether the task finished.
+     */
+    void task_ran(GeneralTask&, std::chrono::nanoseconds, bool) override;
+
+    [[nodiscard]] inline size_t runnable() const noexcept override
+    {
+        return timeline_.size();
+    }
+
+    /**
+     * @brief Retrieves the minimum virtual runtime, which never decreases.
+     *
+     * @return float The virtual runtime in milliseconds.
+     */
+    [[nodiscard]] inline float min_virtual_runtime() const noexcept
+    {
+        return min_virtual_runtime_;
+    }
+
+    /**
+     * @brief Retrieves the load weight of a nice value (Linux sched_prio_to_weight).
+     *
+     * @param nice The nice value, clamped to [-20, 19].
+     * @return uint32_t The weight; CFS_NICE_0_WEIGHT for nice 0.
+     */
+    [[nodiscard]] static uint32_t weight_of(int) noexcept;
+
+private:
+    std::multimap<float, std::shared_ptr<GeneralTask>> timeline_;
+    uint64_t total_weight_ = 0; ///< Sum of the weights of the tasks in the tree.
+    float min_virtual_runtime_ = 0.0f;
+};
\ No newline at end of file
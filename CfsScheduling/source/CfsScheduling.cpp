@@ -0,0 +1,80 @@
+#include "CfsScheduling/CfsScheduling.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    constexpr std::array<uint32_t, 40> NICE_TO_WEIGHT = {
+        88761, 71755, 56483, 46273, 36291,
+        29154, 23254, 18705, 14949, 11916,
+        9548,  7620,  6100,  4904,  3906,
+        3121,  2501,  1991,  1586,  1277,
+        1024,  820,   655,   526,   423,
+        335,   272,   215,   172,   137,
+        110,   87,    70,    56,    45,
+        36,    29,    23,    18,    15
+    };
+}
+
+uint32_t CfsScheduling::weight_of(int nice) noexcept
+{
+    return NICE_TO_WEIGHT[std::clamp(nice, -20, 19) + 20];
+}
+
+size_t CfsScheduling::select_next_task(const std::vector<std::shared_ptr<GeneralTask>>& tasks)
+{
+    if (tasks.empty())
+        throw std::runtime_error("No tasks available");
+
+    size_t selected = 0;
+    for (size_t i = 1; i < tasks.size(); ++i) 
+    {
+        if (tasks[i]->get_virtual_runtime() < tasks[selected]->get_virtual_runtime())
+            selected = i;
+    }
+    return selected;
+}
+
+void CfsScheduling::enqueue(std::shared_ptr<GeneralTask> task)
+{
+    float virtual_runtime = std::max(task->get_virtual_runtime(), min_virtual_runtime_);
+    task->set_virtual_runtime(virtual_runtime);
+    total_weight_ += weight_of(task->get_static_priority());
+    timeline_.emplace(virtual_runtime, std::move(task));
+}
+
+std::shared_ptr<GeneralTask> CfsScheduling::pick_next()
+{
+    if (timeline_.empty())
+        return nullptr;
+
+    auto leftmost = timeline_.begin();
+    auto task = std::move(leftmost->second);
+    timeline_.erase(leftmost);
+    total_weight_ -= weight_of(task->get_static_priority());
+    return task;
+}
+
+std::chrono::milliseconds CfsScheduling::time_slice(const GeneralTask& task, std::chrono::milliseconds quantum) const
+{
+    uint64_t weight = weight_of(task.get_static_priority());
+    uint64_t running = timeline_.size() + 1;
+    auto period = std::max<int64_t>(quantum.count(), static_cast<int64_t>(running) * CFS_MIN_GRANULARITY_MS);
+    auto slice = static_cast<int64_t>(period * weight / (total_weight_ + weight));
+    return std::chrono::milliseconds(std::max<int64_t>(slice, CFS_MIN_GRANULARITY_MS));
+}
+
+void CfsScheduling::task_ran(GeneralTask& task, std::chrono::nanoseconds ran, bool completed)
+{
+    float ran_ms = std::chrono::duration<float, std::milli>(ran).count();
+    float virtual_runtime = task.get_virtual_runtime() +
+        ran_ms * CFS_NICE_0_WEIGHT / weight_of(task.get_static_priority());
+    task.set_virtual_runtime(virtual_runtime);
+
+    // The minimum follows the leftmost runnable task and the task that ran, whichever is smaller.
+    float candidate = completed ? min_virtual_runtime_ : virtual_runtime;
+    if (!timeline_.empty())
+        candidate = completed ? timeline_.begin()->first : std::min(candidate, timeline_.begin()->first);
+    min_virtual_runtime_ = std::max(min_virtual_runtime_, candidate);
+}
\ No newline at end of file
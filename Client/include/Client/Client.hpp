@@ -1,6 +1,6 @@
 #pragma once 
 
-#include <Logger/Logger.hpp>
+#include <Logger/SharedLogChannel.hpp>
 
 #include <arpa/inet.h>
 #include <cstring>
@@ -30,8 +30,9 @@ public:
      *
      * Initializes two loggers: one for error logging and one for normal event logging.
      */
-    explicit Client() : logger_(std::make_shared<ErrorLogger>(LOGS_DIR, CLIENT_ERROR)), 
-        logger_normal_(std::make_shared<FileLogger>(LOGS_DIR, CLIENT)){}
+    explicit Client() :
+        logger_(std::make_shared<SharedLogger>(LOGS_DIR, CLIENT_ERROR, OverflowPolicy::COUNT, LogFormat::ERROR)),
+        logger_normal_(std::make_shared<SharedLogger>(LOGS_DIR, CLIENT)){}
 
     /**
      * @brief Sends a command to the server.
@@ -7,7 +7,7 @@ void Client::send_command(const std::string& command)
 
     if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) 
     {
-        logger_->log("Socket creation error");
+        LOG_ERROR(logger_, "Socket creation error");
         return;
     }
 
@@ -16,18 +16,18 @@ void Client::send_command(const std::string& command)
 
     if (inet_pton(AF_INET, "127.0.0.1", &serv_addr.sin_addr) <= 0) 
     {
-        logger_->log("Invalid address/ Address not supported");
+        LOG_ERROR(logger_, "Invalid address/ Address not supported");
         return;
     }
 
     if (connect(sock, (struct sockaddr*)&serv_addr, sizeof(serv_addr)) < 0) 
     {
-        logger_->log("Connection Failed");
+        LOG_ERROR(logger_, "Connection Failed");
         return;
     }
 
     send(sock, command.c_str(), command.size(), 0);
-    logger_normal_->log("Command sent: " + command);
+    LOG_INFO(logger_normal_, "Command sent: " + command);
 
     close(sock);
 }
\ No newline at end of file
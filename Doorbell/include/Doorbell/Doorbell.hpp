@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Logger/SharedLogChannel.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#define DOORBELL_DIR "doorbell_error"
+
+/**
+ * @class Doorbell
+ * @brief An eventfd that tells consumers in any process that a queue has new work.
+ *
+ * The descriptor is readable while the doorbell has been rung and not drained, so
+ * it can be added to an epoll (or poll/select) set next to sockets and timers. The
+ * creating process hands the descriptor to other processes over a Unix socket with
+ * SCM_RIGHTS (see DoorbellServer and receive()); all copies refer to the same
+ * kernel counter.
+ */
+class Doorbell final
+{
+public:
+
+    /**
+     * @brief Creates a new non-blocking eventfd.
+     *
+     * @throws std::runtime_error If eventfd fails.
+     */
+    Doorbell();
+
+    /**
+     * @brief Takes ownership of an existing eventfd descriptor.
+     */
+    explicit Doorbell(int fd) noexcept : fd_(fd) {}
+
+    Doorbell(const Doorbell&) = delete;
+    Doorbell& operator=(const Doorbell&) = delete;
+
+    /**
+     * @brief Closes the descriptor.
+     */
+    ~Doorbell();
+
+    /**
+     * @brief Connects to a DoorbellServer and receives its descriptor.
+     *
+     * @param socket_path The path the server listens on.
+     * @return The doorbell shared with the server process.
+     * @throws std::runtime_error If the connection fails or no descriptor arrives.
+     */
+    static std::shared_ptr<Doorbell> receive(const std::string&);
+
+    /**
+     * @brief Sends the descriptor over a connected Unix socket.
+     *
+     * @param socket The connected socket.
+     * @throws std::runtime_error If sendmsg fails.
+     */
+    void send(int) const;
+
+    /**
+     * @brief Adds to the counter, making the descriptor readable.
+     *
+     * @param count The value to add (default: 1).
+     */
+    void ring(uint64_t = 1) noexcept;
+
+    /**
+     * @brief Resets the counter without blocking.
+     *
+     * @return The number of rings since the last drain, 0 if none.
+     */
+    uint64_t drain() noexcept;
+
+    /**
+     * @brief Gets the descriptor to be polled for readability.
+     */
+    [[nodiscard]] inline int fd() const noexcept
+    {
+        return fd_;
+    }
+
+private:
+    int fd_;
+};
+
+/**
+ * @class DoorbellServer
+ * @brief Hands a doorbell to every process that connects to a Unix socket.
+ *
+ * A background thread accepts connections on `socket_path` and sends the eventfd
+ * over each of them with SCM_RIGHTS. The socket file is removed on destruction.
+ */
+class DoorbellServer final
+{
+public:
+
+    /**
+     * @brief Starts serving the doorbell.
+     *
+     * @param doorbell The doorbell to hand out.
+     * @param socket_path The path of the listening Unix socket; a stale file is replaced.
+     * @throws std::runtime_error If the socket cannot be bound or listened on.
+     */
+    DoorbellServer(std::shared_ptr<Doorbell>, const std::string&);
+
+    DoorbellServer(const DoorbellServer&) = delete;
+    DoorbellServer& operator=(const DoorbellServer&) = delete;
+
+    /**
+     * @brief Stops the accepting thread and removes the socket file.
+     */
+    ~DoorbellServer();
+
+    /**
+     * @brief Gets the path of the listening socket.
+     */
+    [[nodiscard]] inline const std::string& path() const noexcept
+    {
+        return path_;
+    }
+
+private:
+
+    /**
+     * @brief Accepts connections until the listening socket is shut down.
+     */
+    void serve();
+
+    std::shared_ptr<Doorbell> doorbell_;
+    std::string path_;
+    int listen_fd_;
+    std::atomic<bool> running_;
+    std::thread thread_;
+
+    std::shared_ptr<Logger> logger_error_;
+};
\ No newline at end of file
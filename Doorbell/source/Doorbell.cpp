@@ -0,0 +1,163 @@
+#include "Doorbell/Doorbell.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    sockaddr_un socket_address(const std::string& path)
+    {
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path))
+            throw std::invalid_argument("Doorbell socket path is too long: " + path);
+
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return address;
+    }
+}
+
+Doorbell::Doorbell() : fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (fd_ == -1)
+        throw std::runtime_error("eventfd failed: " + std::string(strerror(errno)));
+}
+
+Doorbell::~Doorbell()
+{
+    if (fd_ != -1)
+        close(fd_);
+}
+
+std::shared_ptr<Doorbell> Doorbell::receive(const std::string& socket_path)
+{
+    sockaddr_un address = socket_address(socket_path);
+
+    int socket_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_fd == -1)
+        throw std::runtime_error("Socket creation failed: " + std::string(strerror(errno)));
+
+    if (connect(socket_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1)
+    {
+        int error = errno;
+        close(socket_fd);
+        throw std::runtime_error("Connecting to doorbell failed: " + std::string(strerror(error)));
+    }
+
+    char byte = 0;
+    iovec data{&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t received = recvmsg(socket_fd, &message, MSG_CMSG_CLOEXEC);
+    close(socket_fd);
+
+    cmsghdr* header = received > 0 ? CMSG_FIRSTHDR(&message) : nullptr;
+    if (!header || header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS)
+        throw std::runtime_error("No doorbell descriptor received from " + socket_path);
+
+    int fd;
+    std::memcpy(&fd, CMSG_DATA(header), sizeof(fd));
+    return std::make_shared<Doorbell>(fd);
+}
+
+void Doorbell::send(int socket) const
+{
+    char byte = 0;
+    iovec data{&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(header), &fd_, sizeof(fd_));
+
+    if (sendmsg(socket, &message, MSG_NOSIGNAL) == -1)
+        throw std::runtime_error("Sending doorbell failed: " + std::string(strerror(errno)));
+}
+
+void Doorbell::ring(uint64_t count) noexcept
+{
+    while (write(fd_, &count, sizeof(count)) == -1 && errno == EINTR)
+        ;
+}
+
+uint64_t Doorbell::drain() noexcept
+{
+    uint64_t count = 0;
+    if (read(fd_, &count, sizeof(count)) != sizeof(count))
+        return 0;
+    return count;
+}
+
+DoorbellServer::DoorbellServer(std::shared_ptr<Doorbell> doorbell, const std::string& socket_path)
+    : doorbell_(std::move(doorbell)), path_(socket_path), listen_fd_(-1), running_(true)
+{
+    logger_error_ = std::make_shared<SharedLogger>(LOGS_DIR, DOORBELL_DIR, OverflowPolicy::COUNT, LogFormat::ERROR);
+    sockaddr_un address = socket_address(path_);
+
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ == -1)
+        throw std::runtime_error("Socket creation failed: " + std::string(strerror(errno)));
+
+    unlink(path_.c_str());
+    if (bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1 ||
+        listen(listen_fd_, SOMAXCONN) == -1)
+    {
+        int error = errno;
+        close(listen_fd_);
+        throw std::runtime_error("Doorbell socket setup failed: " + std::string(strerror(error)));
+    }
+
+    thread_ = std::thread(&DoorbellServer::serve, this);
+}
+
+DoorbellServer::~DoorbellServer()
+{
+    running_.store(false);
+    shutdown(listen_fd_, SHUT_RDWR);
+    if (thread_.joinable())
+        thread_.join();
+    close(listen_fd_);
+    unlink(path_.c_str());
+}
+
+void DoorbellServer::serve()
+{
+    while (running_.load())
+    {
+        int client = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client == -1)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            if (running_.load())
+                LOG_ERROR(logger_error_, "Doorbell accept failed: " + std::string(strerror(errno)));
+            return;
+        }
+
+        try
+        {
+            doorbell_->send(client);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR(logger_error_, e.what());
+        }
+        close(client);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+static const std::string EDF_SCHEDULING = "Earliest Deadline First";
+
+/**
+ * @class EdfScheduling
+ * @brief Implements earliest-deadline-first scheduling on the absolute deadlines of the tasks.
+ *
+ * The runnable task with the nearest deadline always runs next; on one processor this
+ * meets every deadline whenever any order does. Tasks without a deadline run after all
+ * tasks that have one, in arrival order.
+ *
+ * @details
+ * - **Run Queue**: Runnable tasks are kept in a binary min-heap keyed by deadline, ties
+ *   broken by arrival; enqueue() and pick_next() are O(log n).
+ * - **Admission Test**: When enabled, a task is rejected if, with the work already in the
+ *   run queue, it would miss its deadline or make a task that can still meet its deadline
+ *   miss it (processor demand test). The work of a CPU-intensive task is its remaining
+ *   work in milliseconds; the work of other task types is unknown and not counted.
+ * - **Algorithm Name**: The name of the algorithm is returned as "Earliest Deadline First".
+ */
+class EdfScheduling : public SchedulingAlgorithm
+{
+public:
+    /**
+     * @brief Constructs the algorithm.
+     *
+     * @param admission Whether arriving tasks are submitted to the admission test (default: false).
+     */
+    explicit EdfScheduling(bool admission = false) : admission_(admission) {}
+
+    /**
+     * @brief Selects the task with the nearest deadline.
+     *
+     * @param tasks A vector of shared pointers to GeneralTask objects representing the available tasks.
+     * @return The index of the selected task in the input vector.
+     * @throws std::runtime_error if the task list is empty.
+     */
+    size_t select_next_task(const std::vector<std::shared_ptr<GeneralTask>>&) override;
+
+    /**
+     * @brief No-op implementation for updating task priority.
+     *
+     * The order of the tasks follows from their deadline.
+     *
+     * @param task A shared pointer to the GeneralTask object (unused in this implementation).
+     */
+    void update_task_priority(std::shared_ptr<GeneralTask>) override {}
+
+    /**
+     * @brief Returns the name of the scheduling algorithm.
+     *
+     * @return A string containing the name of the algorithm: "Earliest Deadline First".
+     */
+    [[nodiscard]] inline std::string get_name() const override
+    {
+        return EDF_SCHEDULING;
+    }
+
+    [[nodiscard]] inline bool has_run_queue() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Runs the admission test, if enabled, for a task with a deadline.
+     *
+     * @param task The arriving task.
+     * @return False if the task cannot be scheduled without missing a deadline.
+     */
+    bool admit(const GeneralTask&) override;
+
+    /**
+     * @brief Inserts a task into the heap.
+     *
+     * @param task The runnable task.
+     */
+    void enqueue(std::shared_ptr<GeneralTask>) override;
+
+    /**
+     * @brief Removes the task with the nearest deadline.
+     *
+     * @return The task, or nullptr if no task is runnable.
+     */
+    std::shared_ptr<GeneralTask> pick_next() override;
+
+    [[nodiscard]] inline size_t runnable() const noexcept override
+    {
+        return heap_.size();
+    }
+
+    /**
+     * @brief Retrieves the number of tasks refused by the admission test.
+     */
+    [[nodiscard]] inline uint64_t rejected() const noexcept
+    {
+        return rejected_;
+    }
+
+    /**
+     * @brief Estimates the processor time a task still needs.
+     *
+     * @param task The task.
+     * @return The remaining work of a CPU-intensive task, zero for other task types.
+     */
+    [[nodiscard]] static std::chrono::milliseconds demand_of(const GeneralTask&) noexcept;
+
+private:
+    /**
+     * @struct Entry
+     * @brief A task in the heap with its ordering key.
+     */
+    struct Entry
+    {
+        std::chrono::steady_clock::time_point deadline_;
+        uint64_t sequence_;
+        std::shared_ptr<GeneralTask> task_;
+    };
+
+    /**
+     * @brief Orders the heap so that the nearest deadline, then the earliest arrival, is on top.
+     */
+    [[nodiscard]] static inline bool later(const Entry& lhs, const Entry& rhs) noexcept
+    {
+        if (lhs.deadline_ != rhs.deadline_)
+            return lhs.deadline_ > rhs.deadline_;
+        return lhs.sequence_ > rhs.sequence_;
+    }
+
+    std::vector<Entry> heap_;
+    uint64_t sequence_ = 0; ///< Arrival counter breaking ties between equal deadlines.
+    bool admission_;
+    uint64_t rejected_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "EdfScheduling/EdfScheduling.hpp"
+
+#include <algorithm>
+#include <utility>
+
+size_t EdfScheduling::select_next_task(const std::vector<std::shared_ptr<GeneralTask>>& tasks)
+{
+    if (tasks.empty())
+        throw std::runtime_error("No tasks available");
+
+    size_t selected = 0;
+    for (size_t i = 1; i < tasks.size(); ++i)
+    {
+        if (tasks[i]->get_deadline() < tasks[selected]->get_deadline())
+            selected = i;
+    }
+    return selected;
+}
+
+std::chrono::milliseconds EdfScheduling::demand_of(const GeneralTask& task) noexcept
+{
+    if (task.get_type() != TaskType::CPU_INTENSIVE_TASK)
+        return std::chrono::milliseconds::zero();
+
+    TaskProgress progress{};
+    task.save_progress(progress);
+    return std::chrono::milliseconds(std::max(progress.remaining_work_, 0));
+}
+
+bool EdfScheduling::admit(const GeneralTask& task)
+{
+    auto deadline = task.get_deadline();
+    if (!admission_ || deadline == NO_DEADLINE)
+        return true;
+
+    std::vector<std::pair<std::chrono::steady_clock::time_point, std::chrono::milliseconds>> queued;
+    queued.reserve(heap_.size());
+    for (const auto& entry : heap_)
+    {
+        if (entry.deadline_ != NO_DEADLINE)
+            queued.emplace_back(entry.deadline_, demand_of(*entry.task_));
+    }
+    std::sort(queued.begin(), queued.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // The task runs after the queued tasks with a deadline not later than its own and
+    // delays every task with a later deadline by its demand.
+    auto demand = demand_of(task);
+    auto finish = std::chrono::steady_clock::now();
+    auto later = queued.begin();
+    for (; later != queued.end() && later->first <= deadline; ++later)
+        finish += later->second;
+
+    finish += demand;
+    bool feasible = finish <= deadline;
+    for (; feasible && later != queued.end(); ++later)
+    {
+        finish += later->second;
+        feasible = finish <= later->first || finish - demand > later->first;
+    }
+
+    if (!feasible)
+        ++rejected_;
+    return feasible;
+}
+
+void EdfScheduling::enqueue(std::shared_ptr<GeneralTask> task)
+{
+    auto deadline = task->get_deadline();
+    heap_.push_back(Entry{deadline, sequence_++, std::move(task)});
+    std::push_heap(heap_.begin(), heap_.end(), later);
+}
+
+std::shared_ptr<GeneralTask> EdfScheduling::pick_next()
+{
+    if (heap_.empty())
+        return nullptr;
+
+    std::pop_heap(heap_.begin(), heap_.end(), later);
+    auto task = std::move(heap_.back().task_);
+    heap_.pop_back();
+    return task;
+}
\ No newline at end of file
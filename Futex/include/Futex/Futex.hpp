@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @class FutexEvent
+ * @brief Cross-process wait/notify primitive placed inside a shared mapping.
+ *
+ * A waiter registers itself, snapshots the event word, re-checks its condition
+ * and only then sleeps in the kernel. A notifier bumps the word and issues a
+ * FUTEX_WAKE only when somebody is registered, so the uncontended path never
+ * enters the kernel. The object holds two plain 32-bit words and has no
+ * constructor: it is meant to live in zero-initialized shared memory and be
+ * cleared with reset() by the segment creator.
+ */
+class FutexEvent
+{
+public:
+    /**
+     * @brief Resets the event to its initial state.
+     */
+    inline void reset() noexcept
+    {
+        word_.store(0, std::memory_order_relaxed);
+        waiters_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sleeps until the event is notified, unless `ready` already holds.
+     *
+     * Spurious returns are possible, callers re-check their condition in a loop.
+     *
+     * @param ready Returns true when waiting is no longer necessary.
+     * @param deadline The latest point to sleep until (default: no limit).
+     */
+    template <typename Predicate>
+    void wait(Predicate ready, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max())
+    {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t observed = word_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!ready()) 
+        {
+            if (deadline == std::chrono::steady_clock::time_point::max())
+                futex(FUTEX_WAIT, observed, nullptr);
+            else 
+            {
+                auto remaining = std::max(deadline - std::chrono::steady_clock::now(), 
+                                          std::chrono::steady_clock::duration::zero());
+                auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+                timespec timeout{static_cast<time_t>(seconds.count()),
+                    static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - seconds).count())};
+                futex(FUTEX_WAIT, observed, &timeout);
+            }
+        }
+
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Wakes up to `count` waiters if anyone is blocked on the event.
+     *
+     * Must be called after the state change the waiters are checking for.
+     *
+     * @param count The maximum number of waiters to wake.
+     */
+    inline void notify(size_t count = 1)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        word_.fetch_add(1, std::memory_order_release);
+        futex(FUTEX_WAKE, static_cast<uint32_t>(std::min<size_t>(count, INT_MAX)), nullptr);
+    }
+
+private:
+    inline void futex(int operation, uint32_t value, const timespec* timeout)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word_), operation, value, timeout, nullptr, 0);
+    }
+
+    std::atomic<uint32_t> word_;
+    std::atomic<uint32_t> waiters_;
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+                  "futex words must be plain 32-bit integers");
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Logger/BinaryLog.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class LogDecoder
+ * @brief Turns a binary log written by AsyncLogger back into text.
+ *
+ * Every event and text frame becomes one line prefixed with its timestamp in the
+ * `[DD.MM.YYYY HH:MM:SS]` form of FileLogger, so a decoded binary log reads like a
+ * text log. Format definitions are remembered across decode() calls, which allows
+ * decoding a log split into several files in order.
+ */
+class LogDecoder final
+{
+public:
+
+    /**
+     * @brief Decodes a binary log.
+     *
+     * An event whose format has not been defined is printed with its format id and raw
+     * arguments.
+     *
+     * @param input The binary log, starting with BINARY_LOG_MAGIC.
+     * @param output Receives the lines.
+     * @return The number of lines written.
+     * @throws std::runtime_error If the magic is missing, a frame has an unknown tag or the
+     * last frame is truncated.
+     */
+    size_t decode(std::istream&, std::ostream&);
+
+private:
+
+    /**
+     * @brief Writes the timestamp prefix of a line.
+     */
+    static void write_timestamp(std::ostream&, int64_t);
+
+    std::unordered_map<uint32_t, std::string> formats_;
+};
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "LogDecode/LogDecoder.hpp"
+
+#include <ctime>
+#include <iomanip>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    bool read_value(std::istream& input, T& value)
+    {
+        return static_cast<bool>(input.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+    std::string read_text(std::istream& input)
+    {
+        uint16_t length = 0;
+        std::string text;
+        if (read_value(input, length))
+        {
+            text.resize(length);
+            if (!input.read(text.data(), length))
+                throw std::runtime_error("Truncated text in binary log");
+        }
+        else
+            throw std::runtime_error("Truncated frame in binary log");
+        return text;
+    }
+}
+
+size_t LogDecoder::decode(std::istream& input, std::ostream& output)
+{
+    char magic[BINARY_LOG_MAGIC_SIZE];
+    if (!input.read(magic, BINARY_LOG_MAGIC_SIZE) || std::string(magic, BINARY_LOG_MAGIC_SIZE) != BINARY_LOG_MAGIC)
+        throw std::runtime_error("Not a binary log");
+
+    size_t lines = 0;
+    FrameTag tag;
+    while (read_value(input, tag))
+    {
+        switch (tag)
+        {
+            case FrameTag::FORMAT:
+            {
+                uint32_t id = 0;
+                if (!read_value(input, id))
+                    throw std::runtime_error("Truncated format frame in binary log");
+                formats_[id] = read_text(input);
+                break;
+            }
+
+            case FrameTag::EVENT:
+            {
+                uint32_t id = 0;
+                int64_t timestamp_ns = 0;
+                uint8_t count = 0;
+                if (!read_value(input, id) || !read_value(input, timestamp_ns) || !read_value(input, count))
+                    throw std::runtime_error("Truncated event frame in binary log");
+
+                std::vector<int64_t> arguments(count);
+                for (auto& argument : arguments)
+                    if (!read_value(input, argument))
+                        throw std::runtime_error("Truncated event frame in binary log");
+
+                write_timestamp(output, timestamp_ns);
+                auto format = formats_.find(id);
+                if (format != formats_.end())
+                    output << render_event(format->second, arguments);
+                else
+                {
+                    output << "[unknown format " << std::hex << id << std::dec << "]";
+                    for (int64_t argument : arguments)
+                        output << ' ' << argument;
+                }
+                output << '\n';
+                ++lines;
+                break;
+            }
+
+            case FrameTag::TEXT:
+            {
+                int64_t timestamp_ns = 0;
+                if (!read_value(input, timestamp_ns))
+                    throw std::runtime_error("Truncated text frame in binary log");
+                std::string text = read_text(input);
+                write_timestamp(output, timestamp_ns);
+                output << text << '\n';
+                ++lines;
+                break;
+            }
+
+            default:
+                throw std::runtime_error("Unknown frame tag " + std::to_string(static_cast<int>(tag)) +
+                    " in binary log");
+        }
+    }
+    return lines;
+}
+
+void LogDecoder::write_timestamp(std::ostream& output, int64_t timestamp_ns)
+{
+    std::time_t time = static_cast<std::time_t>(timestamp_ns / 1000000000);
+    std::tm local{};
+    localtime_r(&time, &local);
+    output << "[" << std::put_time(&local, "%d.%m.%Y %H:%M:%S") << "] ";
+}
\ No newline at end of file
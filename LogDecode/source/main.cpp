@@ -0,0 +1,35 @@
+#include <LogDecode/LogDecoder.hpp>
+
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char* argv[]) 
+{
+    if (argc < 2) 
+    {
+        std::cerr << "Usage: logdecode <binary log>...\n";
+        return 1;
+    }
+
+    LogDecoder decoder;
+    for (int i = 1; i < argc; ++i) 
+    {
+        std::ifstream input(argv[i], std::ios::binary);
+        if (!input) 
+        {
+            std::cerr << "Cannot open " << argv[i] << "\n";
+            return 1;
+        }
+
+        try 
+        {
+            decoder.decode(input, std::cout);
+        } 
+        catch (const std::exception& e) 
+        {
+            std::cerr << argv[i] << ": " << e.what() << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <Logger/Logger.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#define LOG_RING_RECORDS 1024
+#define LOG_RECORD_SIZE 256
+#define LOG_DESTINATIONS 64
+#define LOG_BATCH 256
+#define LOG_FLUSH_INTERVAL_MS 1
+#define LOG_CACHE_LINE 64
+
+/**
+ * @enum OverflowPolicy
+ * @brief What a caller does when its ring is full.
+ *
+ * DROP discards the record silently, BLOCK waits for the writer thread to make room,
+ * COUNT discards the record and the writer thread reports the number of discarded
+ * records in the log file.
+ */
+enum class OverflowPolicy
+{
+    DROP,
+    BLOCK,
+    COUNT
+};
+
+/**
+ * @enum LogFormat
+ * @brief How the writer thread stores a record.
+ *
+ * TIMESTAMPED and ERROR write text lines prefixed like FileLogger and ErrorLogger;
+ * BINARY writes the frames described by FrameTag, to be turned into text by logdecode.
+ */
+enum class LogFormat
+{
+    TIMESTAMPED,
+    ERROR,
+    BINARY
+};
+
+#ifdef BINARY_STATE_LOG
+#define STATE_LOG_FORMAT LogFormat::BINARY
+#else
+#define STATE_LOG_FORMAT LogFormat::TIMESTAMPED
+#endif
+
+/**
+ * @struct LogRecord
+ * @brief One cell of a log ring.
+ *
+ * A text record holds a copy of the message, truncated to LOG_RECORD_SIZE - 16 bytes.
+ * An event record holds the address of its registered format and its raw arguments;
+ * it is rendered or encoded by the writer thread.
+ */
+struct LogRecord
+{
+    enum class Kind : uint8_t
+    {
+        TEXT,
+        EVENT
+    };
+
+    struct Event
+    {
+        const EventFormat* format_;
+        int64_t arguments_[MAX_EVENT_ARGUMENTS];
+    };
+
+    int64_t timestamp_ns_;
+    uint32_t destination_;
+    uint16_t length_; ///< Text length, or number of event arguments.
+    Kind kind_;
+    union
+    {
+        char text_[LOG_RECORD_SIZE - 16];
+        Event event_;
+    };
+};
+
+static_assert(sizeof(LogRecord) == LOG_RECORD_SIZE, "log records must not be padded");
+
+/**
+ * @class LogRing
+ * @brief A single-producer single-consumer ring of log records owned by one thread.
+ */
+class LogRing final
+{
+public:
+
+    /**
+     * @brief Gets the next free record to be filled by the owning thread.
+     *
+     * @return The record, or nullptr if the ring is full.
+     */
+    LogRecord* try_reserve() noexcept;
+
+    /**
+     * @brief Hands the record returned by try_reserve() to the writer thread.
+     */
+    inline void publish() noexcept
+    {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Marks the ring as abandoned by its thread; it is freed once its records are written.
+     */
+    inline void retire() noexcept
+    {
+        retired_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gets the number of records waiting to be written.
+     */
+    [[nodiscard]] inline size_t size() const noexcept
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class AsyncLogBackend;
+
+    alignas(LOG_CACHE_LINE) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+    alignas(LOG_CACHE_LINE) std::atomic<size_t> head_{0};
+    std::atomic<bool> retired_{false};
+    LogRecord records_[LOG_RING_RECORDS];
+};
+
+class SharedLogChannel;
+
+/**
+ * @class AsyncLogBackend
+ * @brief The process-wide writer of all asynchronous loggers.
+ *
+ * Every thread that logs gets its own LogRing on first use, so a caller only copies its
+ * message into memory it owns and publishes it with one release store. A background
+ * thread drains the rings, formats the prefixes and writes runs of records that go to
+ * the same file with one writev() call. Idle, it polls every LOG_FLUSH_INTERVAL_MS.
+ *
+ * Files are opened once per path and shared by all loggers writing to them. The ring of
+ * a thread is freed after the thread exits and its records are written. A forked child
+ * starts its own writer thread when it first logs.
+ *
+ * Once serve() was called, the writer thread also drains the SharedLogChannel whenever
+ * this process holds or can take the drainer role.
+ */
+class AsyncLogBackend final
+{
+public:
+
+    /**
+     * @brief Gets the backend, starting the writer thread on first use.
+     */
+    static AsyncLogBackend& instance();
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+    /**
+     * @brief Writes all pending records and stops the writer thread.
+     */
+    ~AsyncLogBackend();
+
+    /**
+     * @brief Opens a log file, or finds it if it is already open.
+     *
+     * @param path The path of the file; it is opened in append mode.
+     * @param format The prefix written before each record.
+     * @return The destination index.
+     * @throws std::runtime_error If the file cannot be opened or LOG_DESTINATIONS files are open.
+     */
+    uint32_t open(const std::string&, LogFormat);
+
+    /**
+     * @brief Queues a record from the calling thread.
+     *
+     * @param destination The destination index returned by open().
+     * @param message The text of the record.
+     * @param policy What to do if the ring of the thread is full.
+     * @return False if the record was discarded.
+     */
+    bool push(uint32_t, std::string_view, OverflowPolicy);
+
+    /**
+     * @brief Queues an event from the calling thread.
+     *
+     * @param destination The destination index returned by open().
+     * @param format The registered format; it must outlive the backend.
+     * @param arguments The arguments, at most MAX_EVENT_ARGUMENTS.
+     * @param policy What to do if the ring of the thread is full.
+     * @return False if the event was discarded.
+     */
+    bool push_event(uint32_t, const EventFormat&, std::span<const int64_t>, OverflowPolicy);
+
+    /**
+     * @brief Lets the writer thread compete for the drainer role of a shared channel.
+     *
+     * @param channel The channel; it must outlive the backend.
+     */
+    void serve(SharedLogChannel&);
+
+    /**
+     * @brief Waits until every record queued before the call has been written.
+     *
+     * Records in a served channel are waited for at most LOG_CHANNEL_FLUSH_TIMEOUT_MS,
+     * since they may be written by another process.
+     */
+    void flush();
+
+    /**
+     * @brief Gets the number of records discarded under OverflowPolicy::COUNT and not yet reported.
+     */
+    [[nodiscard]] uint64_t dropped(uint32_t) const noexcept;
+
+private:
+
+    /**
+     * @struct Destination
+     * @brief An open log file.
+     */
+    struct Destination
+    {
+        std::string path_;
+        int fd_ = -1;
+        LogFormat format_ = LogFormat::TIMESTAMPED;
+        std::atomic<uint64_t> dropped_{0};
+        std::unordered_set<uint32_t> formats_; ///< Formats already defined in a binary file.
+    };
+
+    AsyncLogBackend();
+
+    /**
+     * @brief Gets the ring of the calling thread, creating it on first use.
+     */
+    LogRing& ring();
+
+    /**
+     * @brief Reserves a record in the ring of the calling thread, fills and publishes it.
+     */
+    template <typename Fill>
+    bool push_record(uint32_t, OverflowPolicy, Fill&&);
+
+    /**
+     * @brief Starts the writer thread unless it runs in this process.
+     */
+    void start();
+
+    /**
+     * @brief Writer thread body: drains the rings until stopped.
+     */
+    void run();
+
+    /**
+     * @brief Writes and releases the pending records of all rings and frees retired rings.
+     *
+     * @return The number of records written.
+     */
+    size_t drain_all();
+
+    /**
+     * @brief Writes and releases the pending records of one ring.
+     */
+    size_t drain(LogRing&);
+
+    /**
+     * @brief Writes the records of the served channel if this process is its drainer.
+     *
+     * @return The number of records written.
+     */
+    size_t drain_channel();
+
+    /**
+     * @brief Writes a run of records going to one destination with a single writev().
+     */
+    void write_batch(uint32_t, const LogRecord*const*, size_t);
+
+    /**
+     * @brief Encodes a run of records as binary frames and writes them.
+     */
+    void write_binary_batch(Destination&, const LogRecord*const*, size_t);
+
+    /**
+     * @brief Formats the prefix of a record and returns its length.
+     */
+    size_t format_prefix(const Destination&, int64_t, char*);
+
+    std::array<Destination, LOG_DESTINATIONS> destinations_;
+    std::atomic<uint32_t> destination_count_{0};
+    std::mutex open_mutex_;
+
+    std::vector<std::unique_ptr<LogRing>> rings_;
+    std::mutex rings_mutex_;
+
+    std::atomic<bool> started_{false};
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> passes_{0}; ///< Completed drains over all rings, flush() waits for two.
+    std::unique_ptr<std::thread> thread_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+
+    std::atomic<SharedLogChannel*> channel_{nullptr};
+    std::array<uint32_t, LOG_DESTINATIONS> channel_destinations_; ///< Channel index to destination, UINT32_MAX if unopened.
+    std::unordered_map<uint32_t, EventFormat> channel_formats_;
+    std::vector<LogRecord> channel_records_;
+
+    std::vector<std::string> rendered_;
+    std::vector<char> frames_;
+
+    int64_t cached_second_ = -1;
+    char cached_time_[32] = {};
+    size_t cached_time_length_ = 0;
+};
+
+/**
+ * @class AsyncLogger
+ * @brief A logger that queues messages for the writer thread of AsyncLogBackend.
+ *
+ * Produces the same files as FileLogger (LogFormat::TIMESTAMPED) or ErrorLogger
+ * (LogFormat::ERROR), but the caller never formats the timestamp and never waits
+ * for the file system, so it is meant for the scheduling path.
+ */
+class AsyncLogger : public Logger
+{
+public:
+
+    /**
+     * @brief Constructs an `AsyncLogger` instance.
+     *
+     * @param log_dir The directory where the log file will be stored; it is created if missing.
+     * @param log_file_name The name of the log file.
+     * @param policy What to do when the ring of the logging thread is full (default: COUNT).
+     * @param format The prefix of each record (default: TIMESTAMPED).
+     */
+    AsyncLogger(const std::string&, const std::string&, OverflowPolicy = OverflowPolicy::COUNT,
+        LogFormat = LogFormat::TIMESTAMPED);
+
+    /**
+     * @brief Queues a message; it is timestamped with the time of this call.
+     *
+     * @param message The message to log.
+     */
+    void log_with_timestamp(const std::string&) override;
+
+    /**
+     * @brief Waits until every message queued before the call has been written.
+     */
+    static void flush();
+
+protected:
+
+    /**
+     * @brief Queues the raw arguments of an event; the writer thread renders or encodes them.
+     */
+    void log_event(const EventFormat&, std::span<const int64_t>) override;
+
+private:
+    AsyncLogBackend& backend_;
+    uint32_t destination_;
+    OverflowPolicy policy_;
+};
\ No newline at end of file
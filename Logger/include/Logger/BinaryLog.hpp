@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#define BINARY_LOG_MAGIC "TQBLOG1\n"
+#define BINARY_LOG_MAGIC_SIZE 8
+#define MAX_EVENT_ARGUMENTS 8
+
+/**
+ * @enum FrameTag
+ * @brief The first byte of every frame in a binary log file.
+ *
+ * A binary log starts with BINARY_LOG_MAGIC and continues with frames in native byte
+ * order and without padding:
+ *  - FORMAT: tag, uint32 id, uint16 length, `length` bytes of format text. Written before
+ *    the first event of a format in a file; a later definition of the same id replaces it.
+ *  - EVENT: tag, uint32 id, int64 timestamp in ns since the epoch, uint8 count, `count`
+ *    int64 arguments.
+ *  - TEXT: tag, int64 timestamp in ns since the epoch, uint16 length, `length` bytes of text.
+ */
+enum class FrameTag : uint8_t
+{
+    FORMAT = 1,
+    EVENT = 2,
+    TEXT = 3
+};
+
+/**
+ * @struct EventFormat
+ * @brief A log message format registered at compile time by Logger::event().
+ *
+ * In the text, `{}` stands for an integer argument and `{A|B|C}` for an enumeration
+ * argument printed by name, 0 being A; a value without a name is printed as a number.
+ */
+struct EventFormat
+{
+    uint32_t id_;
+    const char* text_;
+    size_t arguments_;
+};
+
+/**
+ * @struct FormatString
+ * @brief A string literal usable as a template argument, from which the id and the
+ * argument count of a format are computed at compile time.
+ */
+template <size_t N>
+struct FormatString
+{
+    char text_[N];
+
+    constexpr FormatString(const char (&text)[N])
+    {
+        std::copy_n(text, N, text_);
+    }
+
+    /**
+     * @brief Gets the FNV-1a hash of the text, used as the format id.
+     */
+    [[nodiscard]] constexpr uint32_t id() const noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i + 1 < N; ++i)
+            hash = (hash ^ static_cast<uint8_t>(text_[i])) * 16777619u;
+        return hash;
+    }
+
+    /**
+     * @brief Gets the number of placeholders in the text.
+     */
+    [[nodiscard]] constexpr size_t arguments() const noexcept
+    {
+        return static_cast<size_t>(std::count(text_, text_ + N, '{'));
+    }
+};
+
+/**
+ * @brief Renders an event as text.
+ *
+ * @param format The format text.
+ * @param arguments The arguments, one per placeholder; missing ones are printed as `?`.
+ * @return The message.
+ */
+std::string render_event(std::string_view, std::span<const int64_t>);
\ No newline at end of file
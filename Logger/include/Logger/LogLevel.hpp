@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARN 3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF 5
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_TRACE
+#endif
+
+/**
+ * @enum LogLevel
+ * @brief The severity of a log message.
+ *
+ * Messages below LOG_MIN_LEVEL are removed at compile time by the LOG_* macros;
+ * messages below the runtime threshold (Logger::set_threshold) are skipped before
+ * their text or arguments are evaluated.
+ */
+enum class LogLevel : uint8_t
+{
+    TRACE = LOG_LEVEL_TRACE,
+    DEBUG = LOG_LEVEL_DEBUG,
+    INFO = LOG_LEVEL_INFO,
+    WARN = LOG_LEVEL_WARN,
+    ERROR = LOG_LEVEL_ERROR,
+    OFF = LOG_LEVEL_OFF
+};
+
+/**
+ * @brief Checks whether messages of the given level are compiled in.
+ *
+ * @param level The level of the message.
+ * @return True if `level` is not below LOG_MIN_LEVEL.
+ */
+[[nodiscard]] constexpr bool compiled_in(LogLevel level) noexcept
+{
+    return level >= static_cast<LogLevel>(LOG_MIN_LEVEL);
+}
+
+/**
+ * @brief Logs a message built from the remaining arguments if `level` is enabled.
+ *
+ * The message expression is only evaluated after the level check and is not compiled
+ * into the caller at all if `level` is below LOG_MIN_LEVEL.
+ */
+#define LOG_AT(level, logger, ...)                                       \
+    do                                                                   \
+    {                                                                    \
+        if constexpr (compiled_in(level))                                \
+        {                                                                \
+            if (Logger::enabled(level))                                  \
+                (logger)->log(__VA_ARGS__);                              \
+        }                                                                \
+    }                                                                    \
+    while (0)
+
+/**
+ * @brief Logs an event with a compile-time format (see Logger::event) if `level` is enabled.
+ */
+#define LOG_EVENT_AT(level, logger, format, ...)                         \
+    do                                                                   \
+    {                                                                    \
+        if constexpr (compiled_in(level))                                \
+        {                                                                \
+            if (Logger::enabled(level))                                  \
+                (logger)->event<format>(__VA_ARGS__);                    \
+        }                                                                \
+    }                                                                    \
+    while (0)
+
+#define LOG_TRACE(logger, ...) LOG_AT(LogLevel::TRACE, logger, __VA_ARGS__)
+#define LOG_DEBUG(logger, ...) LOG_AT(LogLevel::DEBUG, logger, __VA_ARGS__)
+#define LOG_INFO(logger, ...) LOG_AT(LogLevel::INFO, logger, __VA_ARGS__)
+#define LOG_WARN(logger, ...) LOG_AT(LogLevel::WARN, logger, __VA_ARGS__)
+#define LOG_ERROR(logger, ...) LOG_AT(LogLevel::ERROR, logger, __VA_ARGS__)
+
+#define LOG_TRACE_EVENT(logger, format, ...) LOG_EVENT_AT(LogLevel::TRACE, logger, format, __VA_ARGS__)
+#define LOG_DEBUG_EVENT(logger, format, ...) LOG_EVENT_AT(LogLevel::DEBUG, logger, format, __VA_ARGS__)
+#define LOG_INFO_EVENT(logger, format, ...) LOG_EVENT_AT(LogLevel::INFO, logger, format, __VA_ARGS__)
\ No newline at end of file
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <Logger/BinaryLog.hpp>
+#include <Logger/LogLevel.hpp>
+
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <filesystem>
@@ -32,8 +37,54 @@ public:
      */
     void log(const std::string&);
 
+    /**
+     * @brief Logs an event whose format is registered at compile time.
+     *
+     * Only the arguments are handed to the logger: loggers writing text render them with
+     * the format, binary loggers store them as they are.
+     *
+     * @tparam Format The format, see EventFormat.
+     * @param arguments Integral or enumeration values, one per placeholder.
+     */
+    template <FormatString Format, typename... Args>
+    void event(Args... arguments)
+    {
+        static_assert(sizeof...(Args) == Format.arguments(), "one argument per placeholder is required");
+        static_assert(sizeof...(Args) <= MAX_EVENT_ARGUMENTS, "too many event arguments");
+
+        static constexpr EventFormat FORMAT{Format.id(), Format.text_, Format.arguments()};
+        const std::array<int64_t, sizeof...(Args)> values{static_cast<int64_t>(arguments)...};
+        log_event(FORMAT, values);
+    }
+
+    /**
+     * @brief Sets the lowest level logged by the LOG_* macros in this process.
+     *
+     * @param level The threshold; LogLevel::OFF silences all macros.
+     */
+    static void set_threshold(LogLevel) noexcept;
+
+    /**
+     * @brief Checks a level against the runtime threshold.
+     *
+     * @param level The level of a message.
+     * @return True if messages of this level are logged.
+     */
+    [[nodiscard]] static inline bool enabled(LogLevel level) noexcept
+    {
+        return level >= threshold_.load(std::memory_order_relaxed);
+    }
+
 protected:
 
+    /**
+     * @brief Logs an event; renders it as text and passes it to `log` by default.
+     *
+     * @param format The registered format.
+     * @param arguments The arguments of the event.
+     */
+    virtual void log_event(const EventFormat&, std::span<const int64_t>);
+
     /**
      * @brief Formats a message with a timestamp.
      * 
@@ -52,6 +103,9 @@ protected:
      * @param message The message to log, already formatted with a timestamp.
      */
     virtual void log_with_timestamp(const std::string&) = 0;
+
+private:
+    static std::atomic<LogLevel> threshold_;
 };
 
 /**
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <Logger/AsyncLogger.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+
+#define LOG_CHANNEL_NAME "/task_scheduler_log"
+#define LOG_CHANNEL_MAGIC 0x544c4f4743484e31ull
+#define LOG_CHANNEL_RECORDS 4096
+#define LOG_CHANNEL_FORMATS 128
+#define LOG_CHANNEL_PATH_SIZE 240
+#define LOG_CHANNEL_CLAIM_INTERVAL_MS 100
+#define LOG_CHANNEL_STALL_MS 1000
+#define LOG_CHANNEL_FLUSH_TIMEOUT_MS 2000
+#define LOG_CHANNEL_ATTACH_TIMEOUT_MS 1000
+#define LOG_CHANNEL_WRITING (1ull << 63)
+
+/**
+ * @class SharedLogChannel
+ * @brief A multi-producer log ring in POSIX shared memory, written to files by one process.
+ *
+ * Every process that logs through a SharedLogger maps the same segment and claims slots
+ * with per-slot sequence numbers, like QueueMode::LOCK_FREE of PosixSharedMemory. Log
+ * files and event formats are registered by path and id in tables inside the segment,
+ * so a record names its file and format by index and producers never open a file.
+ *
+ * The writer thread of the AsyncLogBackend of exactly one process, the drainer, empties
+ * the ring: the first process to serve the channel claims the role, and another one takes
+ * it over when the drainer exits or dies. Descriptors and write calls therefore depend only
+ * on the number of log files, not on the number of tasks, queues and processes.
+ *
+ * A producer fills its record outside the ring, then claims the reserved slot by replacing
+ * its sequence with LOG_CHANNEL_WRITING and its process id, copies the record in and
+ * publishes it. A producer that dies or stalls before the claim would block the ring; the
+ * drainer skips such a slot after LOG_CHANNEL_STALL_MS, and the late producer's claim then
+ * fails and drops its record instead of overwriting the slot's next use. A claimed slot is
+ * skipped only once the process that claimed it has died. The segment is never unlinked,
+ * so records left behind by a drainer that died are written by the next one.
+ */
+class SharedLogChannel final
+{
+public:
+
+    /**
+     * @struct Record
+     * @brief The content of one slot.
+     *
+     * A text record holds its message truncated to LOG_RECORD_SIZE - 32 bytes, an event
+     * record the id of its format and its raw arguments.
+     */
+    struct Record
+    {
+        int64_t timestamp_ns_;
+        uint32_t destination_; ///< Index in the destination table of the segment.
+        uint32_t format_; ///< Format id of an event.
+        uint16_t length_; ///< Text length, or number of event arguments.
+        LogRecord::Kind kind_;
+        union
+        {
+            char text_[LOG_RECORD_SIZE - 32];
+            int64_t arguments_[MAX_EVENT_ARGUMENTS];
+        };
+    };
+
+    /**
+     * @brief Gets the channel of this process, attaching to LOG_CHANNEL_NAME or creating it.
+     *
+     * The mapping stays valid until the process exits.
+     *
+     * @throws std::runtime_error If the segment cannot be created or mapped, or has another layout.
+     */
+    static SharedLogChannel& instance();
+
+    SharedLogChannel(const SharedLogChannel&) = delete;
+    SharedLogChannel& operator=(const SharedLogChannel&) = delete;
+
+    /**
+     * @brief Registers a log file, or finds it if another process already did.
+     *
+     * @param path The path of the file.
+     * @param format How the drainer writes the records of the file.
+     * @return The destination index.
+     * @throws std::invalid_argument If the path is longer than LOG_CHANNEL_PATH_SIZE - 1.
+     * @throws std::runtime_error If LOG_DESTINATIONS files are registered.
+     */
+    uint32_t open(const std::string&, LogFormat);
+
+    /**
+     * @brief Queues a record.
+     *
+     * @param destination The destination index returned by open().
+     * @param message The text of the record.
+     * @param policy What to do if the ring is full.
+     * @return False if the record was discarded.
+     */
+    bool push(uint32_t, std::string_view, OverflowPolicy);
+
+    /**
+     * @brief Queues an event; it is queued as rendered text if its format cannot be registered.
+     *
+     * @param destination The destination index returned by open().
+     * @param format The format of the event.
+     * @param arguments The arguments, at most MAX_EVENT_ARGUMENTS.
+     * @param policy What to do if the ring is full.
+     * @return False if the event was discarded.
+     */
+    bool push_event(uint32_t, const EventFormat&, std::span<const int64_t>, OverflowPolicy);
+
+    /**
+     * @brief Makes the calling process the drainer if there is none or the drainer died.
+     *
+     * A live drainer is probed at most every LOG_CHANNEL_CLAIM_INTERVAL_MS.
+     *
+     * @return True if the calling process is the drainer.
+     */
+    bool claim() noexcept;
+
+    /**
+     * @brief Checks whether the calling process is the drainer.
+     */
+    [[nodiscard]] bool is_drainer() const noexcept;
+
+    /**
+     * @brief Gives up the drainer role if the calling process holds it.
+     */
+    void release() noexcept;
+
+    /**
+     * @brief Moves the oldest published records out of the ring; only called by the drainer.
+     *
+     * @param records Where to copy the records.
+     * @return The number of records copied.
+     */
+    size_t take(std::span<Record>) noexcept;
+
+    /**
+     * @brief Gets a registered log file.
+     *
+     * @param destination The destination index.
+     * @param format Receives the format of the file.
+     * @return The path, or an empty view if the index is not registered.
+     */
+    std::string_view destination(uint32_t, LogFormat&) const noexcept;
+
+    /**
+     * @brief Gets and resets the number of records of a file discarded under OverflowPolicy::COUNT.
+     */
+    uint64_t take_dropped(uint32_t) noexcept;
+
+    /**
+     * @brief Looks up a registered event format.
+     *
+     * @param id The format id.
+     * @param arguments Receives the number of placeholders.
+     * @return The format text, which lives as long as the mapping, or nullptr if the id is unknown.
+     */
+    const char* format(uint32_t, size_t&) const noexcept;
+
+    /**
+     * @brief Gets the number of records ever reserved.
+     */
+    [[nodiscard]] uint64_t tail() const noexcept;
+
+    /**
+     * @brief Gets the number of records ever taken by a drainer.
+     */
+    [[nodiscard]] uint64_t head() const noexcept;
+
+private:
+
+    enum EntryState : uint32_t
+    {
+        FREE,
+        CLAIMED,
+        READY
+    };
+
+    struct alignas(LOG_CACHE_LINE) Slot
+    {
+        std::atomic<uint64_t> sequence_;
+        Record record_;
+    };
+
+    struct Destination
+    {
+        std::atomic<uint32_t> state_;
+        LogFormat format_;
+        std::atomic<uint64_t> dropped_;
+        char path_[LOG_CHANNEL_PATH_SIZE];
+    };
+
+    struct Format
+    {
+        std::atomic<uint32_t> state_;
+        uint32_t id_;
+        uint16_t arguments_;
+        char text_[LOG_RECORD_SIZE - 10];
+    };
+
+    /**
+     * @struct Layout
+     * @brief The shared memory segment.
+     */
+    struct Layout
+    {
+        std::atomic<uint64_t> magic_;
+        uint64_t size_;
+        std::atomic<pid_t> drainer_;
+        alignas(LOG_CACHE_LINE) std::atomic<uint64_t> tail_;
+        alignas(LOG_CACHE_LINE) std::atomic<uint64_t> head_;
+        Destination destinations_[LOG_DESTINATIONS];
+        Format formats_[LOG_CHANNEL_FORMATS];
+        Slot slots_[LOG_CHANNEL_RECORDS];
+    };
+
+    static_assert(sizeof(Slot) == LOG_RECORD_SIZE, "log channel slots must not be padded");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<pid_t>::is_always_lock_free,
+        "log channel counters must be lock-free to be shared between processes");
+
+    explicit SharedLogChannel(const std::string&);
+
+    /**
+     * @brief Reserves, fills and publishes a slot.
+     */
+    template <typename Fill>
+    bool push_record(uint32_t, OverflowPolicy, Fill&&);
+
+    /**
+     * @brief Finds or adds a format in the format table.
+     *
+     * @return False if the table is full or the text does not fit.
+     */
+    bool register_format(const EventFormat&) noexcept;
+
+    Layout* layout_;
+
+    int64_t last_claim_ms_ = 0;
+    uint64_t stalled_position_ = UINT64_MAX;
+    int64_t stalled_since_ms_ = 0;
+};
+
+/**
+ * @class SharedLogger
+ * @brief A logger that queues messages in the SharedLogChannel.
+ *
+ * Produces the same files as AsyncLogger, but the calling process does not open them:
+ * the drainer process writes the records of all processes. Constructing a SharedLogger
+ * lets the writer thread of this process compete for the drainer role.
+ */
+class SharedLogger : public Logger
+{
+public:
+
+    /**
+     * @brief Constructs a `SharedLogger` instance.
+     *
+     * @param log_dir The directory where the log file will be stored; it is created if missing.
+     * @param log_file_name The name of the log file.
+     * @param policy What to do when the channel is full (default: COUNT).
+     * @param format How the drainer writes the records (default: TIMESTAMPED).
+     */
+    SharedLogger(const std::string&, const std::string&, OverflowPolicy = OverflowPolicy::COUNT,
+        LogFormat = LogFormat::TIMESTAMPED);
+
+    /**
+     * @brief Queues a message; it is timestamped with the time of this call.
+     *
+     * @param message The message to log.
+     */
+    void log_with_timestamp(const std::string&) override;
+
+protected:
+
+    /**
+     * @brief Queues the format id and the raw arguments of an event.
+     */
+    void log_event(const EventFormat&, std::span<const int64_t>) override;
+
+private:
+    SharedLogChannel& channel_;
+    uint32_t destination_;
+    OverflowPolicy policy_;
+};
\ No newline at end of file
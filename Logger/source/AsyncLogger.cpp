@@ -0,0 +1,582 @@
+#include "Logger/AsyncLogger.hpp"
+#include "Logger/SharedLogChannel.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace
+{
+    /**
+     * @brief Owns the pointer to the ring of the current thread and retires the ring on thread exit.
+     */
+    struct RingHandle
+    {
+        LogRing* ring_ = nullptr;
+
+        ~RingHandle();
+    };
+
+    thread_local RingHandle current_ring;
+
+    AsyncLogBackend* fork_backend = nullptr;
+
+    void write_vectors(int fd, iovec* vectors, size_t count) noexcept
+    {
+        while (count != 0)
+        {
+            ssize_t written = writev(fd, vectors, static_cast<int>(std::min<size_t>(count, IOV_MAX)));
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return;
+            }
+
+            while (count != 0 && static_cast<size_t>(written) >= vectors->iov_len)
+            {
+                written -= static_cast<ssize_t>(vectors->iov_len);
+                ++vectors;
+                --count;
+            }
+            if (count != 0)
+            {
+                vectors->iov_base = static_cast<char*>(vectors->iov_base) + written;
+                vectors->iov_len -= static_cast<size_t>(written);
+            }
+        }
+    }
+}
+
+LogRecord* LogRing::try_reserve() noexcept
+{
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == LOG_RING_RECORDS)
+    {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == LOG_RING_RECORDS)
+            return nullptr;
+    }
+    return &records_[tail % LOG_RING_RECORDS];
+}
+
+RingHandle::~RingHandle()
+{
+    if (ring_)
+        ring_->retire();
+}
+
+AsyncLogBackend& AsyncLogBackend::instance()
+{
+    static AsyncLogBackend backend;
+    return backend;
+}
+
+AsyncLogBackend::AsyncLogBackend()
+{
+    fork_backend = this;
+    rendered_.resize(LOG_BATCH);
+    channel_records_.resize(LOG_BATCH);
+    channel_destinations_.fill(UINT32_MAX);
+    pthread_atfork(
+        []
+        {
+            fork_backend->open_mutex_.lock();
+            fork_backend->rings_mutex_.lock();
+            fork_backend->wake_mutex_.lock();
+        },
+        []
+        {
+            fork_backend->wake_mutex_.unlock();
+            fork_backend->rings_mutex_.unlock();
+            fork_backend->open_mutex_.unlock();
+        },
+        []
+        {
+            // The writer thread does not exist in the child: forget it, drop the records the
+            // parent will write and retire the rings of the threads that were not forked.
+            (void)fork_backend->thread_.release();
+            fork_backend->started_.store(false);
+            for (auto& ring : fork_backend->rings_)
+            {
+                ring->head_.store(ring->tail_.load());
+                ring->cached_head_ = ring->tail_.load();
+                if (ring.get() != current_ring.ring_)
+                    ring->retired_.store(true);
+            }
+            fork_backend->wake_mutex_.unlock();
+            fork_backend->rings_mutex_.unlock();
+            fork_backend->open_mutex_.unlock();
+        });
+    start();
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+    if (started_.load())
+    {
+        stop_.store(true, std::memory_order_release);
+        wake_.notify_one();
+        thread_->join();
+    }
+    drain_all();
+    if (SharedLogChannel* channel = channel_.load(std::memory_order_acquire))
+    {
+        while (drain_channel() != 0)
+            ;
+        channel->release();
+    }
+
+    for (uint32_t i = 0; i < destination_count_.load(); ++i)
+        close(destinations_[i].fd_);
+
+    // Threads still running at exit keep their ring; the memory is left to the OS.
+    for (auto& ring : rings_)
+        (void)ring.release();
+}
+
+void AsyncLogBackend::start()
+{
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    if (started_.load(std::memory_order_relaxed))
+        return;
+
+    stop_.store(false);
+    thread_ = std::make_unique<std::thread>(&AsyncLogBackend::run, this);
+    started_.store(true, std::memory_order_release);
+}
+
+uint32_t AsyncLogBackend::open(const std::string& path, LogFormat format)
+{
+    std::lock_guard<std::mutex> lock(open_mutex_);
+
+    uint32_t count = destination_count_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i)
+        if (destinations_[i].path_ == path)
+            return i;
+
+    if (count == LOG_DESTINATIONS)
+        throw std::runtime_error("Too many log files are open");
+
+    int fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (fd == -1)
+        throw std::runtime_error("Failed to open log file " + path + ": " + std::string(strerror(errno)));
+
+    struct stat status{};
+    if (format == LogFormat::BINARY && fstat(fd, &status) == 0 && status.st_size == 0)
+    {
+        iovec magic{const_cast<char*>(BINARY_LOG_MAGIC), BINARY_LOG_MAGIC_SIZE};
+        write_vectors(fd, &magic, 1);
+    }
+
+    destinations_[count].path_ = path;
+    destinations_[count].fd_ = fd;
+    destinations_[count].format_ = format;
+    destination_count_.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+LogRing& AsyncLogBackend::ring()
+{
+    if (!current_ring.ring_)
+    {
+        std::unique_ptr<LogRing> ring(new LogRing);
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        current_ring.ring_ = ring.get();
+        rings_.push_back(std::move(ring));
+    }
+    return *current_ring.ring_;
+}
+
+template <typename Fill>
+bool AsyncLogBackend::push_record(uint32_t destination, OverflowPolicy policy, Fill&& fill)
+{
+    LogRing& ring = this->ring();
+    if (!started_.load(std::memory_order_acquire))
+        start();
+
+    LogRecord* record = ring.try_reserve();
+    if (!record)
+    {
+        switch (policy)
+        {
+            case OverflowPolicy::BLOCK:
+                while (!(record = ring.try_reserve()))
+                {
+                    wake_.notify_one();
+                    std::this_thread::yield();
+                }
+                break;
+
+            case OverflowPolicy::COUNT:
+                destinations_[destination].dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+
+            case OverflowPolicy::DROP:
+            default:
+                return false;
+        }
+    }
+
+    record->timestamp_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record->destination_ = destination;
+    fill(*record);
+    ring.publish();
+    return true;
+}
+
+bool AsyncLogBackend::push(uint32_t destination, std::string_view message, OverflowPolicy policy)
+{
+    return push_record(destination, policy, [message](LogRecord& record)
+    {
+        record.kind_ = LogRecord::Kind::TEXT;
+        record.length_ = static_cast<uint16_t>(std::min(message.size(), sizeof(record.text_)));
+        std::memcpy(record.text_, message.data(), record.length_);
+    });
+}
+
+bool AsyncLogBackend::push_event(uint32_t destination, const EventFormat& format, std::span<const int64_t> arguments,
+    OverflowPolicy policy)
+{
+    return push_record(destination, policy, [&format, arguments](LogRecord& record)
+    {
+        record.kind_ = LogRecord::Kind::EVENT;
+        record.length_ = static_cast<uint16_t>(std::min<size_t>(arguments.size(), MAX_EVENT_ARGUMENTS));
+        record.event_.format_ = &format;
+        std::copy_n(arguments.begin(), record.length_, record.event_.arguments_);
+    });
+}
+
+void AsyncLogBackend::serve(SharedLogChannel& channel)
+{
+    channel_.store(&channel, std::memory_order_release);
+    if (!started_.load(std::memory_order_acquire))
+        start();
+}
+
+void AsyncLogBackend::flush()
+{
+    if (!started_.load(std::memory_order_acquire))
+        start();
+
+    SharedLogChannel* channel = channel_.load(std::memory_order_acquire);
+    uint64_t channel_target = channel ? channel->tail() : 0;
+
+    uint64_t target = passes_.load(std::memory_order_acquire) + 2;
+    while (passes_.load(std::memory_order_acquire) < target)
+    {
+        wake_.notify_one();
+        std::this_thread::yield();
+    }
+
+    if (!channel)
+        return;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOG_CHANNEL_FLUSH_TIMEOUT_MS);
+    while (channel->head() < channel_target && std::chrono::steady_clock::now() < deadline)
+    {
+        wake_.notify_one();
+        std::this_thread::yield();
+    }
+
+    // The drainer releases a batch before writing it.
+    target = passes_.load(std::memory_order_acquire) + 2;
+    while (passes_.load(std::memory_order_acquire) < target && channel->is_drainer())
+    {
+        wake_.notify_one();
+        std::this_thread::yield();
+    }
+}
+
+uint64_t AsyncLogBackend::dropped(uint32_t destination) const noexcept
+{
+    return destinations_[destination].dropped_.load(std::memory_order_relaxed);
+}
+
+void AsyncLogBackend::run()
+{
+    while (!stop_.load(std::memory_order_acquire))
+    {
+        size_t written = drain_all() + drain_channel();
+        passes_.fetch_add(1, std::memory_order_release);
+        if (written == 0)
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL_MS));
+        }
+    }
+}
+
+size_t AsyncLogBackend::drain_all()
+{
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+
+    size_t written = 0;
+    for (auto it = rings_.begin(); it != rings_.end();)
+    {
+        bool retired = (*it)->retired_.load(std::memory_order_acquire);
+        written += drain(**it);
+        if (retired)
+            it = rings_.erase(it);
+        else
+            ++it;
+    }
+    return written;
+}
+
+size_t AsyncLogBackend::drain(LogRing& ring)
+{
+    size_t head = ring.head_.load(std::memory_order_relaxed);
+    size_t tail = ring.tail_.load(std::memory_order_acquire);
+
+    const LogRecord* batch[LOG_BATCH];
+    size_t count = 0;
+    uint32_t destination = 0;
+    for (size_t position = head; position != tail; ++position)
+    {
+        const LogRecord& record = ring.records_[position % LOG_RING_RECORDS];
+        if (count == LOG_BATCH || (count != 0 && record.destination_ != destination))
+        {
+            write_batch(destination, batch, count);
+            count = 0;
+        }
+        destination = record.destination_;
+        batch[count++] = &record;
+    }
+    if (count != 0)
+        write_batch(destination, batch, count);
+
+    ring.head_.store(tail, std::memory_order_release);
+    return tail - head;
+}
+
+size_t AsyncLogBackend::drain_channel()
+{
+    SharedLogChannel* channel = channel_.load(std::memory_order_acquire);
+    if (!channel || !channel->claim())
+        return 0;
+
+    auto destination_of = [this, channel](uint32_t index)
+    {
+        if (index < LOG_DESTINATIONS && channel_destinations_[index] == UINT32_MAX)
+        {
+            LogFormat format = LogFormat::TIMESTAMPED;
+            std::string_view path = channel->destination(index, format);
+            try
+            {
+                if (!path.empty())
+                    channel_destinations_[index] = open(std::string(path), format);
+            }
+            catch (const std::exception&)
+            {
+                // Unwritable file: its records are discarded.
+            }
+        }
+        return index < LOG_DESTINATIONS ? channel_destinations_[index] : UINT32_MAX;
+    };
+
+    for (uint32_t index = 0; index < LOG_DESTINATIONS; ++index)
+        if (uint64_t dropped = channel->take_dropped(index))
+        {
+            uint32_t destination = destination_of(index);
+            if (destination != UINT32_MAX)
+                destinations_[destination].dropped_.fetch_add(dropped, std::memory_order_relaxed);
+        }
+
+    SharedLogChannel::Record taken[LOG_BATCH];
+    size_t written = 0;
+    for (;;)
+    {
+        size_t count = channel->take(taken);
+        const LogRecord* batch[LOG_BATCH];
+        size_t batched = 0;
+        uint32_t destination = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const SharedLogChannel::Record& shared = taken[i];
+            LogRecord& record = channel_records_[i];
+            record.timestamp_ns_ = shared.timestamp_ns_;
+            record.destination_ = destination_of(shared.destination_);
+            record.kind_ = shared.kind_;
+            record.length_ = shared.length_;
+            if (record.destination_ == UINT32_MAX)
+                continue;
+
+            if (shared.kind_ == LogRecord::Kind::TEXT)
+                std::memcpy(record.text_, shared.text_, shared.length_);
+            else
+            {
+                auto format = channel_formats_.find(shared.format_);
+                size_t arguments = 0;
+                if (format == channel_formats_.end())
+                    if (const char* text = channel->format(shared.format_, arguments))
+                        format = channel_formats_.emplace(shared.format_, EventFormat{shared.format_, text,
+                            arguments}).first;
+                if (format == channel_formats_.end())
+                    continue;
+                record.event_.format_ = &format->second;
+                std::copy_n(shared.arguments_, shared.length_, record.event_.arguments_);
+            }
+
+            if (batched == LOG_BATCH || (batched != 0 && record.destination_ != destination))
+            {
+                write_batch(destination, batch, batched);
+                batched = 0;
+            }
+            destination = record.destination_;
+            batch[batched++] = &record;
+        }
+        if (batched != 0)
+            write_batch(destination, batch, batched);
+
+        written += count;
+        if (count < LOG_BATCH)
+            return written;
+    }
+}
+
+void AsyncLogBackend::write_batch(uint32_t destination, const LogRecord*const* records, size_t count)
+{
+    static char newline = '\n';
+
+    Destination& target = destinations_[destination];
+    if (target.format_ == LogFormat::BINARY)
+    {
+        write_binary_batch(target, records, count);
+        return;
+    }
+
+    iovec vectors[3 * LOG_BATCH + 1];
+    char prefixes[LOG_BATCH][48];
+    char dropped_line[64];
+    size_t used = 0;
+
+    if (uint64_t dropped = target.dropped_.exchange(0, std::memory_order_relaxed))
+    {
+        int length = std::snprintf(dropped_line, sizeof(dropped_line), "[%llu log records dropped]\n",
+            static_cast<unsigned long long>(dropped));
+        vectors[used++] = iovec{dropped_line, static_cast<size_t>(length)};
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        vectors[used++] = iovec{prefixes[i], format_prefix(target, records[i]->timestamp_ns_, prefixes[i])};
+        if (records[i]->kind_ == LogRecord::Kind::EVENT)
+        {
+            const auto& event = records[i]->event_;
+            rendered_[i] = render_event(event.format_->text_, std::span<const int64_t>(event.arguments_,
+                records[i]->length_));
+            vectors[used++] = iovec{rendered_[i].data(), rendered_[i].size()};
+        }
+        else
+            vectors[used++] = iovec{const_cast<char*>(records[i]->text_), records[i]->length_};
+        vectors[used++] = iovec{&newline, 1};
+    }
+
+    write_vectors(target.fd_, vectors, used);
+}
+
+void AsyncLogBackend::write_binary_batch(Destination& target, const LogRecord*const* records, size_t count)
+{
+    frames_.clear();
+    auto append = [this](const auto& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        frames_.insert(frames_.end(), bytes, bytes + sizeof(value));
+    };
+    auto append_text = [&](int64_t timestamp_ns, std::string_view text)
+    {
+        append(FrameTag::TEXT);
+        append(timestamp_ns);
+        append(static_cast<uint16_t>(std::min<size_t>(text.size(), UINT16_MAX)));
+        frames_.insert(frames_.end(), text.begin(), text.begin() + std::min<size_t>(text.size(), UINT16_MAX));
+    };
+
+    if (uint64_t dropped = target.dropped_.exchange(0, std::memory_order_relaxed))
+        append_text(records[0]->timestamp_ns_, "[" + std::to_string(dropped) + " log records dropped]");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const LogRecord& record = *records[i];
+        if (record.kind_ == LogRecord::Kind::TEXT)
+        {
+            append_text(record.timestamp_ns_, std::string_view(record.text_, record.length_));
+            continue;
+        }
+
+        const EventFormat& format = *record.event_.format_;
+        if (target.formats_.insert(format.id_).second)
+        {
+            std::string_view text = format.text_;
+            append(FrameTag::FORMAT);
+            append(format.id_);
+            append(static_cast<uint16_t>(std::min<size_t>(text.size(), UINT16_MAX)));
+            frames_.insert(frames_.end(), text.begin(), text.begin() + std::min<size_t>(text.size(), UINT16_MAX));
+        }
+
+        append(FrameTag::EVENT);
+        append(format.id_);
+        append(record.timestamp_ns_);
+        append(static_cast<uint8_t>(record.length_));
+        for (uint16_t argument = 0; argument < record.length_; ++argument)
+            append(record.event_.arguments_[argument]);
+    }
+
+    iovec frames{frames_.data(), frames_.size()};
+    write_vectors(target.fd_, &frames, 1);
+}
+
+size_t AsyncLogBackend::format_prefix(const Destination& destination, int64_t timestamp_ns, char* prefix)
+{
+    if (destination.format_ == LogFormat::ERROR)
+    {
+        std::memcpy(prefix, "[ERROR] ", 8);
+        return 8;
+    }
+
+    int64_t second = timestamp_ns / 1000000000;
+    if (second != cached_second_)
+    {
+        std::time_t time = static_cast<std::time_t>(second);
+        std::tm local{};
+        localtime_r(&time, &local);
+        cached_time_length_ = std::strftime(cached_time_, sizeof(cached_time_), "[%d.%m.%Y %H:%M:%S] ", &local);
+        cached_second_ = second;
+    }
+    std::memcpy(prefix, cached_time_, cached_time_length_);
+    return cached_time_length_;
+}
+
+AsyncLogger::AsyncLogger(const std::string& log_dir, const std::string& log_file_name, OverflowPolicy policy,
+    LogFormat format) : backend_(AsyncLogBackend::instance()), policy_(policy)
+{
+    if (!std::filesystem::exists(log_dir))
+        std::filesystem::create_directories(log_dir);
+    destination_ = backend_.open(log_dir + "/" + log_file_name, format);
+}
+
+void AsyncLogger::log_with_timestamp(const std::string& message)
+{
+    backend_.push(destination_, message, policy_);
+}
+
+void AsyncLogger::log_event(const EventFormat& format, std::span<const int64_t> arguments)
+{
+    backend_.push_event(destination_, format, arguments, policy_);
+}
+
+void AsyncLogger::flush()
+{
+    AsyncLogBackend::instance().flush();
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "Logger/BinaryLog.hpp"
+
+namespace
+{
+    /**
+     * @brief Gets the name with the given index from a `A|B|C` list, or an empty view.
+     */
+    std::string_view name_of(std::string_view names, int64_t index)
+    {
+        if (names.empty() || index < 0)
+            return {};
+
+        for (; index > 0; --index)
+        {
+            size_t bar = names.find('|');
+            if (bar == std::string_view::npos)
+                return {};
+            names.remove_prefix(bar + 1);
+        }
+        return names.substr(0, names.find('|'));
+    }
+}
+
+std::string render_event(std::string_view format, std::span<const int64_t> arguments)
+{
+    std::string text;
+    text.reserve(format.size() + 8 * arguments.size());
+
+    size_t argument = 0;
+    size_t position = 0;
+    while (position < format.size())
+    {
+        size_t open = format.find('{', position);
+        size_t close = open == std::string_view::npos ? open : format.find('}', open);
+        if (close == std::string_view::npos)
+        {
+            text.append(format.substr(position));
+            break;
+        }
+
+        text.append(format.substr(position, open - position));
+        position = close + 1;
+        if (argument == arguments.size())
+        {
+            text.push_back('?');
+            continue;
+        }
+
+        int64_t value = arguments[argument++];
+        std::string_view name = name_of(format.substr(open + 1, close - open - 1), value);
+        if (name.empty())
+            text.append(std::to_string(value));
+        else
+            text.append(name);
+    }
+    return text;
+}
\ No newline at end of file
@@ -1,10 +1,22 @@
 #include "Logger/Logger.hpp"
 
+std::atomic<LogLevel> Logger::threshold_{LogLevel::TRACE};
+
 void Logger::log(const std::string & message)
 {
     log_with_timestamp(message);
 }
 
+void Logger::set_threshold(LogLevel level) noexcept
+{
+    threshold_.store(level, std::memory_order_relaxed);
+}
+
+void Logger::log_event(const EventFormat& format, std::span<const int64_t> arguments)
+{
+    log(render_event(format.text_, arguments));
+}
+
 std::string Logger::format_with_timestamp(const std::string &message) 
 {
     auto now = std::chrono::system_clock::now();
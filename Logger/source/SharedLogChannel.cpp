@@ -0,0 +1,366 @@
+#include "Logger/SharedLogChannel.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+    int64_t now_ms() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    bool alive(pid_t pid) noexcept
+    {
+        return kill(pid, 0) == 0 || errno != ESRCH;
+    }
+}
+
+SharedLogChannel& SharedLogChannel::instance()
+{
+    static SharedLogChannel channel(LOG_CHANNEL_NAME);
+    return channel;
+}
+
+SharedLogChannel::SharedLogChannel(const std::string& name)
+{
+    bool created = true;
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0666);
+    if (fd == -1 && errno == EEXIST)
+    {
+        created = false;
+        fd = shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0666);
+    }
+    if (fd == -1)
+        throw std::runtime_error("Failed to open log channel " + name + ": " + std::string(strerror(errno)));
+
+    if (created && ftruncate(fd, sizeof(Layout)) == -1)
+    {
+        int error = errno;
+        close(fd);
+        throw std::runtime_error("Failed to size log channel " + name + ": " + std::string(strerror(error)));
+    }
+
+    // The creator may not have sized the segment yet.
+    struct stat status{};
+    int64_t deadline = now_ms() + LOG_CHANNEL_ATTACH_TIMEOUT_MS;
+    while (fstat(fd, &status) == 0 && static_cast<size_t>(status.st_size) < sizeof(Layout) && now_ms() < deadline)
+        std::this_thread::yield();
+    if (static_cast<size_t>(status.st_size) != sizeof(Layout))
+    {
+        close(fd);
+        throw std::runtime_error("Log channel " + name + " has another layout");
+    }
+
+    void* address = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+        throw std::runtime_error("Failed to map log channel " + name + ": " + std::string(strerror(errno)));
+    layout_ = static_cast<Layout*>(address);
+
+    if (created)
+    {
+        // The mapping is zero-filled: all entries are FREE and the counters start at 0.
+        layout_->size_ = sizeof(Layout);
+        for (uint64_t i = 0; i < LOG_CHANNEL_RECORDS; ++i)
+            layout_->slots_[i].sequence_.store(i, std::memory_order_relaxed);
+        layout_->magic_.store(LOG_CHANNEL_MAGIC, std::memory_order_release);
+        return;
+    }
+
+    while (layout_->magic_.load(std::memory_order_acquire) != LOG_CHANNEL_MAGIC && now_ms() < deadline)
+        std::this_thread::yield();
+    if (layout_->magic_.load(std::memory_order_acquire) != LOG_CHANNEL_MAGIC || layout_->size_ != sizeof(Layout))
+    {
+        munmap(layout_, sizeof(Layout));
+        throw std::runtime_error("Log channel " + name + " has another layout");
+    }
+}
+
+uint32_t SharedLogChannel::open(const std::string& path, LogFormat format)
+{
+    if (path.size() >= LOG_CHANNEL_PATH_SIZE)
+        throw std::invalid_argument("Log file path is too long: " + path);
+
+    for (uint32_t i = 0; i < LOG_DESTINATIONS; ++i)
+    {
+        Destination& destination = layout_->destinations_[i];
+        uint32_t state = destination.state_.load(std::memory_order_acquire);
+        if (state == FREE)
+        {
+            if (destination.state_.compare_exchange_strong(state, CLAIMED, std::memory_order_acquire))
+            {
+                std::memcpy(destination.path_, path.c_str(), path.size() + 1);
+                destination.format_ = format;
+                destination.state_.store(READY, std::memory_order_release);
+                return i;
+            }
+        }
+        while (state == CLAIMED)
+        {
+            std::this_thread::yield();
+            state = destination.state_.load(std::memory_order_acquire);
+        }
+        if (destination.path_ == path)
+            return i;
+    }
+    throw std::runtime_error("Too many log files are registered in the log channel");
+}
+
+template <typename Fill>
+bool SharedLogChannel::push_record(uint32_t destination, OverflowPolicy policy, Fill&& fill)
+{
+    uint64_t position = layout_->tail_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;)
+    {
+        slot = &layout_->slots_[position % LOG_CHANNEL_RECORDS];
+        uint64_t sequence = slot->sequence_.load(std::memory_order_acquire);
+        int64_t difference = static_cast<int64_t>(sequence - position);
+        if (difference == 0)
+        {
+            if (layout_->tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            switch (policy)
+            {
+                case OverflowPolicy::BLOCK:
+                    std::this_thread::yield();
+                    position = layout_->tail_.load(std::memory_order_relaxed);
+                    continue;
+
+                case OverflowPolicy::COUNT:
+                    layout_->destinations_[destination].dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+
+                case OverflowPolicy::DROP:
+                default:
+                    return false;
+            }
+        }
+        else
+            position = layout_->tail_.load(std::memory_order_relaxed);
+    }
+
+    Record record;
+    record.timestamp_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.destination_ = destination;
+    fill(record);
+
+    // Fails only if the drainer gave up on this slot as stalled; the slot may then belong
+    // to a producer of the next lap, so the record must not be copied in.
+    uint64_t reserved = position;
+    if (!slot->sequence_.compare_exchange_strong(reserved, LOG_CHANNEL_WRITING | static_cast<uint64_t>(getpid()),
+        std::memory_order_acquire))
+    {
+        if (policy == OverflowPolicy::COUNT)
+            layout_->destinations_[destination].dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    slot->record_ = record;
+    slot->sequence_.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool SharedLogChannel::push(uint32_t destination, std::string_view message, OverflowPolicy policy)
+{
+    return push_record(destination, policy, [message](Record& record)
+    {
+        record.kind_ = LogRecord::Kind::TEXT;
+        record.length_ = static_cast<uint16_t>(std::min(message.size(), sizeof(record.text_)));
+        std::memcpy(record.text_, message.data(), record.length_);
+    });
+}
+
+bool SharedLogChannel::push_event(uint32_t destination, const EventFormat& format, std::span<const int64_t> arguments,
+    OverflowPolicy policy)
+{
+    if (!register_format(format))
+        return push(destination, render_event(format.text_, arguments), policy);
+
+    return push_record(destination, policy, [&format, arguments](Record& record)
+    {
+        record.kind_ = LogRecord::Kind::EVENT;
+        record.format_ = format.id_;
+        record.length_ = static_cast<uint16_t>(std::min<size_t>(arguments.size(), MAX_EVENT_ARGUMENTS));
+        std::copy_n(arguments.begin(), record.length_, record.arguments_);
+    });
+}
+
+bool SharedLogChannel::register_format(const EventFormat& format) noexcept
+{
+    size_t length = std::strlen(format.text_);
+    if (length >= sizeof(Format::text_))
+        return false;
+
+    for (uint32_t i = 0; i < LOG_CHANNEL_FORMATS; ++i)
+    {
+        Format& entry = layout_->formats_[(format.id_ + i) % LOG_CHANNEL_FORMATS];
+        uint32_t state = entry.state_.load(std::memory_order_acquire);
+        if (state == FREE)
+        {
+            if (entry.state_.compare_exchange_strong(state, CLAIMED, std::memory_order_acquire))
+            {
+                entry.id_ = format.id_;
+                entry.arguments_ = static_cast<uint16_t>(format.arguments_);
+                std::memcpy(entry.text_, format.text_, length + 1);
+                entry.state_.store(READY, std::memory_order_release);
+                return true;
+            }
+        }
+        while (state == CLAIMED)
+        {
+            std::this_thread::yield();
+            state = entry.state_.load(std::memory_order_acquire);
+        }
+        if (entry.id_ == format.id_)
+            return true;
+    }
+    return false;
+}
+
+bool SharedLogChannel::claim() noexcept
+{
+    pid_t self = getpid();
+    pid_t drainer = layout_->drainer_.load(std::memory_order_acquire);
+    if (drainer == self)
+        return true;
+
+    if (drainer != 0)
+    {
+        int64_t now = now_ms();
+        if (now - last_claim_ms_ < LOG_CHANNEL_CLAIM_INTERVAL_MS)
+            return false;
+        last_claim_ms_ = now;
+        if (alive(drainer))
+            return false;
+    }
+    return layout_->drainer_.compare_exchange_strong(drainer, self, std::memory_order_acq_rel);
+}
+
+bool SharedLogChannel::is_drainer() const noexcept
+{
+    return layout_->drainer_.load(std::memory_order_acquire) == getpid();
+}
+
+void SharedLogChannel::release() noexcept
+{
+    pid_t self = getpid();
+    layout_->drainer_.compare_exchange_strong(self, 0, std::memory_order_release);
+}
+
+size_t SharedLogChannel::take(std::span<Record> records) noexcept
+{
+    uint64_t head = layout_->head_.load(std::memory_order_relaxed);
+    size_t count = 0;
+    while (count < records.size())
+    {
+        Slot& slot = layout_->slots_[head % LOG_CHANNEL_RECORDS];
+        uint64_t sequence = slot.sequence_.load(std::memory_order_acquire);
+        if (sequence == head + 1)
+        {
+            records[count++] = slot.record_;
+            slot.sequence_.store(head + LOG_CHANNEL_RECORDS, std::memory_order_release);
+            ++head;
+            continue;
+        }
+
+        if (layout_->tail_.load(std::memory_order_acquire) == head)
+            break;
+
+        // Reserved but not published: wait for the producer unless it stalled for too long.
+        // A producer copying its record in is only skipped once its process has died.
+        int64_t now = now_ms();
+        if (stalled_position_ != head)
+        {
+            stalled_position_ = head;
+            stalled_since_ms_ = now;
+            break;
+        }
+        bool writing = (sequence & LOG_CHANNEL_WRITING) != 0;
+        if (now - stalled_since_ms_ < LOG_CHANNEL_STALL_MS ||
+            (writing && alive(static_cast<pid_t>(sequence & ~LOG_CHANNEL_WRITING))) ||
+            !slot.sequence_.compare_exchange_strong(sequence, head + LOG_CHANNEL_RECORDS, std::memory_order_acq_rel))
+            break;
+        ++head;
+    }
+    layout_->head_.store(head, std::memory_order_release);
+    return count;
+}
+
+std::string_view SharedLogChannel::destination(uint32_t destination, LogFormat& format) const noexcept
+{
+    const Destination& entry = layout_->destinations_[destination];
+    if (entry.state_.load(std::memory_order_acquire) != READY)
+        return {};
+    format = entry.format_;
+    return entry.path_;
+}
+
+uint64_t SharedLogChannel::take_dropped(uint32_t destination) noexcept
+{
+    Destination& entry = layout_->destinations_[destination];
+    if (entry.dropped_.load(std::memory_order_relaxed) == 0)
+        return 0;
+    return entry.dropped_.exchange(0, std::memory_order_relaxed);
+}
+
+const char* SharedLogChannel::format(uint32_t id, size_t& arguments) const noexcept
+{
+    for (uint32_t i = 0; i < LOG_CHANNEL_FORMATS; ++i)
+    {
+        const Format& entry = layout_->formats_[(id + i) % LOG_CHANNEL_FORMATS];
+        uint32_t state = entry.state_.load(std::memory_order_acquire);
+        if (state == FREE)
+            return nullptr;
+        if (state == READY && entry.id_ == id)
+        {
+            arguments = entry.arguments_;
+            return entry.text_;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t SharedLogChannel::tail() const noexcept
+{
+    return layout_->tail_.load(std::memory_order_acquire);
+}
+
+uint64_t SharedLogChannel::head() const noexcept
+{
+    return layout_->head_.load(std::memory_order_acquire);
+}
+
+SharedLogger::SharedLogger(const std::string& log_dir, const std::string& log_file_name, OverflowPolicy policy,
+    LogFormat format) : channel_(SharedLogChannel::instance()), policy_(policy)
+{
+    if (!std::filesystem::exists(log_dir))
+        std::filesystem::create_directories(log_dir);
+    destination_ = channel_.open(log_dir + "/" + log_file_name, format);
+    AsyncLogBackend::instance().serve(channel_);
+}
+
+void SharedLogger::log_with_timestamp(const std::string& message)
+{
+    channel_.push(destination_, message, policy_);
+}
+
+void SharedLogger::log_event(const EventFormat& format, std::span<const int64_t> arguments)
+{
+    channel_.push_event(destination_, format, arguments, policy_);
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+#define MLFQ_LEVELS 4
+#define MLFQ_TOP_QUANTUM_MS 10
+#define MLFQ_BOOST_PERIOD_MS 1000
+#define MLFQ_DEMOTE_USAGE 0.9f
+#define MLFQ_PROMOTE_USAGE 0.5f
+
+static const std::string MLFQ_SCHEDULING = "Multi-Level Feedback Queue";
+
+/**
+ * @class MlfqScheduling
+ * @brief Implements a multi-level feedback queue driven by the measured CPU usage of the tasks.
+ *
+ * New tasks start at the top level. The usage of a run is the time the task ran divided
+ * by the quantum of its level. A task that keeps the CPU for its whole quantum (a usage
+ * of at least MLFQ_DEMOTE_USAGE) moves one level down, a task that gives the CPU back
+ * early (at most MLFQ_PROMOTE_USAGE) moves one level up. Short and I/O-bound
+ * requests therefore stay at the top and run ahead of long CPU-bound tasks.
+ *
+ * @details
+ * - **Levels**: MLFQ_LEVELS round-robin queues; level `n` runs for `top_quantum << n`, so
+ *   lower levels run less often but longer. The quantum of the processor is not used.
+ * - **Run Queue**: Each level is a FIFO queue and a bit mask tracks the non-empty levels;
+ *   enqueue() and pick_next() are O(1).
+ * - **Priority Boost**: Every boost period all tasks return to the top level, so that
+ *   CPU-bound tasks cannot starve behind a stream of short requests.
+ * - **Algorithm Name**: The name of the algorithm is returned as "Multi-Level Feedback Queue".
+ */
+class MlfqScheduling : public SchedulingAlgorithm
+{
+public:
+    /**
+     * @brief Constructs the algorithm.
+     *
+     * @param top_quantum The quantum of the top level (default: MLFQ_TOP_QUANTUM_MS).
+     * @param boost_period The time between two priority boosts (default: MLFQ_BOOST_PERIOD_MS).
+     */
+    explicit MlfqScheduling(std::chrono::milliseconds top_quantum = std::chrono::milliseconds(MLFQ_TOP_QUANTUM_MS),
+        std::chrono::milliseconds boost_period = std::chrono::milliseconds(MLFQ_BOOST_PERIOD_MS))
+        : top_quantum_(top_quantum), boost_period_(boost_period),
+        next_boost_(std::chrono::steady_clock::now() + boost_period) {}
+
+    /**
+     * @brief Selects the first task found at the highest level.
+     *
+     * @param tasks A vector of shared pointers to GeneralTask objects representing the available tasks.
+     * @return The index of the selected task in the input vector.
+     * @throws std::runtime_error if the task list is empty.
+     */
+    size_t select_next_task(const std::vector<std::shared_ptr<GeneralTask>>&) override;
+
+    /**
+     * @brief No-op implementation for updating task priority.
+     *
+     * The level of a task follows from its CPU usage.
+     *
+     * @param task A shared pointer to the GeneralTask object (unused in this implementation).
+     */
+    void update_task_priority(std::shared_ptr<GeneralTask>) override {}
+
+    /**
+     * @brief Returns the name of the scheduling algorithm.
+     *
+     * @return A string containing the name of the algorithm: "Multi-Level Feedback Queue".
+     */
+    [[nodiscard]] inline std::string get_name() const override
+    {
+        return MLFQ_SCHEDULING;
+    }
+
+    [[nodiscard]] inline bool has_run_queue() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Appends a task to the queue of its level.
+     *
+     * @param task The runnable task.
+     */
+    void enqueue(std::shared_ptr<GeneralTask>) override;
+
+    /**
+     * @brief Removes the first task of the highest non-empty level, boosting first if the period elapsed.
+     *
+     * @return The task, or nullptr if no task is runnable.
+     */
+    std::shared_ptr<GeneralTask> pick_next() override;
+
+    /**
+     * @brief Returns the quantum of the level of the task.
+     *
+     * @param task The task returned by pick_next().
+     * @param quantum The quantum of the processor (unused).
+     * @return The quantum of the level.
+     */
+    std::chrono::milliseconds time_slice(const GeneralTask&, std::chrono::milliseconds) const override;
+
+    /**
+     * @brief Moves the task one level down or up according to the share of its quantum it used.
+     *
+     * @param task The task.
+     * @param ran The time the task ran.
+     * @param completed Whether the task finished; its level is forgotten then.
+     */
+    void task_ran(GeneralTask&, std::chrono::nanoseconds, bool) override;
+
+    [[nodiscard]] inline size_t runnable() const noexcept override
+    {
+        return runnable_;
+    }
+
+    /**
+     * @brief Moves every task back to the top level.
+     */
+    void boost();
+
+    /**
+     * @brief Retrieves the level of a task.
+     *
+     * @param id The id of the task.
+     * @return size_t The level, 0 being the top level.
+     */
+    [[nodiscard]] size_t level_of(int) const noexcept;
+
+private:
+    std::array<std::deque<std::shared_ptr<GeneralTask>>, MLFQ_LEVELS> levels_;
+    uint32_t occupied_ = 0; ///< Bit `n` is set while level `n` has a task.
+    size_t runnable_ = 0;
+    std::unordered_map<int, uint8_t> task_levels_; ///< Level by task id; absent means the top level.
+    std::chrono::milliseconds top_quantum_;
+    std::chrono::milliseconds boost_period_;
+    std::chrono::steady_clock::time_point next_boost_;
+};
\ No newline at end of file
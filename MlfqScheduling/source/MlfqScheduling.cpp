@@ -0,0 +1,88 @@
+#include "MlfqScheduling/MlfqScheduling.hpp"
+
+#include <bit>
+
+size_t MlfqScheduling::select_next_task(const std::vector<std::shared_ptr<GeneralTask>>& tasks)
+{
+    if (tasks.empty())
+        throw std::runtime_error("No tasks available");
+
+    size_t selected = 0;
+    for (size_t i = 1; i < tasks.size(); ++i)
+    {
+        if (level_of(tasks[i]->get_id()) < level_of(tasks[selected]->get_id()))
+            selected = i;
+    }
+    return selected;
+}
+
+size_t MlfqScheduling::level_of(int id) const noexcept
+{
+    auto it = task_levels_.find(id);
+    return it != task_levels_.cend() ? it->second : 0;
+}
+
+void MlfqScheduling::enqueue(std::shared_ptr<GeneralTask> task)
+{
+    size_t level = level_of(task->get_id());
+    levels_[level].push_back(std::move(task));
+    occupied_ |= 1u << level;
+    ++runnable_;
+}
+
+std::shared_ptr<GeneralTask> MlfqScheduling::pick_next()
+{
+    if (occupied_ == 0)
+        return nullptr;
+
+    if (std::chrono::steady_clock::now() >= next_boost_)
+        boost();
+
+    size_t level = std::countr_zero(occupied_);
+    auto task = std::move(levels_[level].front());
+    levels_[level].pop_front();
+    if (levels_[level].empty())
+        occupied_ &= ~(1u << level);
+    --runnable_;
+    return task;
+}
+
+std::chrono::milliseconds MlfqScheduling::time_slice(const GeneralTask& task, std::chrono::milliseconds) const
+{
+    return top_quantum_ * (1 << level_of(task.get_id()));
+}
+
+void MlfqScheduling::task_ran(GeneralTask& task, std::chrono::nanoseconds ran, bool completed)
+{
+    if (completed)
+    {
+        task_levels_.erase(task.get_id());
+        return;
+    }
+
+    size_t level = level_of(task.get_id());
+    float usage = std::chrono::duration<float>(ran) / std::chrono::duration<float>(top_quantum_ * (1 << level));
+    if (usage >= MLFQ_DEMOTE_USAGE && level + 1 < MLFQ_LEVELS)
+        ++level;
+    else if (usage <= MLFQ_PROMOTE_USAGE && level > 0)
+        --level;
+
+    if (level == 0)
+        task_levels_.erase(task.get_id());
+    else
+        task_levels_[task.get_id()] = static_cast<uint8_t>(level);
+}
+
+void MlfqScheduling::boost()
+{
+    auto& top = levels_[0];
+    for (size_t level = 1; level < MLFQ_LEVELS; ++level)
+    {
+        for (auto& task : levels_[level])
+            top.push_back(std::move(task));
+        levels_[level].clear();
+    }
+    occupied_ = top.empty() ? 0 : 1;
+    task_levels_.clear();
+    next_boost_ = std::chrono::steady_clock::now() + boost_period_;
+}
\ No newline at end of file
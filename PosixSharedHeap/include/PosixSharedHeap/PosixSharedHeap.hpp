@@ -0,0 +1,427 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+#include <SharedMemory/DescriptionTable.hpp>
+#include <Futex/Futex.hpp>
+#include <Logger/SharedLogChannel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <semaphore.h>
+#include <span>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @class PosixSharedHeap
+ * @brief Implements the SharedMemory interface as a priority heap in POSIX shared memory.
+ *
+ * Tasks are kept in a binary max-heap ordered by SharedTask::priority_ directly
+ * inside the mapped segment, so dequeue() always returns the task with the highest
+ * priority (tasks with equal priority leave in FIFO order). Insert, pop-max and
+ * update_priority() are O(log n); nothing is ever drained and rebuilt.
+ *
+ * The heap only moves small HeapNode entries; the tasks themselves stay in a fixed
+ * task region of CompactTask entries and are addressed by slot. An open-addressing table maps task ids to
+ * slots for update_priority(). All operations are serialized through a named
+ * semaphore mutex; blocked producers and consumers sleep on futex events in the segment.
+ */
+class PosixSharedHeap : public SharedMemory
+{
+public:
+
+    /**
+     * @brief Constructor for PosixSharedHeap.
+     *
+     * @param name The name of the shared memory segment.
+     * @param capacity The maximum number of tasks that can be stored in the heap.
+     * @throws std::invalid_argument If the capacity is invalid (zero or exceeds THROW_VALUE).
+     */
+    PosixSharedHeap(const std::string&, size_t = COUNT_TASKS);
+
+    /**
+     * @brief Destructor for PosixSharedHeap.
+     *
+     * Cleans up resources associated with the shared memory segment.
+     */
+    ~PosixSharedHeap() override;
+
+    /**
+     * @struct HeapNode
+     * @brief A heap entry referencing a task slot.
+     *
+     * `order_` is the insertion number of the task and breaks ties between equal
+     * priorities, so the heap is stable.
+     */
+    struct HeapNode
+    {
+        int priority_;
+        uint32_t slot_;
+        uint64_t order_;
+    };
+
+    /**
+     * @struct IdEntry
+     * @brief An entry of the id lookup table, `slot_` is EMPTY_SLOT for unused entries.
+     */
+    struct IdEntry
+    {
+        int id_;
+        uint32_t slot_;
+    };
+
+    static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    /**
+     * @struct SharedHeapLayout
+     * @brief Defines the header of the shared memory segment.
+     *
+     * The header is followed by the heap (`capacity_` HeapNode entries), the task
+     * region (`capacity_` CompactTask entries), the slot-to-heap position map, the
+     * free slot stack, the id table (`table_mask_ + 1` IdEntry entries) and the
+     * DescriptionTable.
+     * map() derives the region pointers from `capacity_`.
+     */
+    struct SharedHeapLayout
+    {
+        alignas(CACHE_LINE) size_t capacity_;
+        size_t table_mask_;
+        std::atomic<bool> scheduler_running_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> count_;
+        size_t free_top_;
+        uint64_t next_order_;
+        size_t total_enqueued_;
+        size_t total_dequeued_;
+
+        alignas(CACHE_LINE) FutexEvent not_empty_;
+        FutexEvent not_full_;
+    };
+
+    /**
+     * @brief Computes the size of the id table for the given capacity.
+     *
+     * The table is a power of two at least twice the capacity, which keeps linear
+     * probe sequences short.
+     *
+     * @param capacity The number of task slots.
+     * @return The number of IdEntry entries.
+     */
+    [[nodiscard]] static constexpr size_t table_size(size_t capacity) noexcept
+    {
+        size_t size = 1;
+        while (size < 2 * capacity)
+            size <<= 1;
+        return size;
+    }
+
+    /**
+     * @brief Computes the size of a segment holding the given number of tasks.
+     *
+     * @param capacity The number of task slots.
+     * @return The size in bytes of the header plus all regions.
+     */
+    [[nodiscard]] static constexpr size_t segment_size(size_t capacity) noexcept
+    {
+        return sizeof(SharedHeapLayout) + capacity * (sizeof(HeapNode) + sizeof(CompactTask) + 2 * sizeof(uint32_t)) +
+            table_size(capacity) * sizeof(IdEntry) + DescriptionTable::footprint(DescriptionTable::default_bytes(capacity));
+    }
+
+    /**
+     * @brief Creates a new shared memory segment.
+     *
+     * @throws std::runtime_error If shared memory or semaphore creation fails.
+     */
+    void create() override;
+
+    /**
+     * @brief Attaches to an existing shared memory segment.
+     *
+     * Reads the capacity from the segment header and maps the segment.
+     * @throws std::runtime_error If attachment fails.
+     */
+    void attach() override;
+
+    /**
+     * @brief Detaches from the shared memory segment.
+     */
+    void detach() override;
+
+    /**
+     * @brief Destroys the shared memory segment.
+     *
+     * Releases all resources associated with the shared memory segment and semaphores.
+     */
+    void destroy() override;
+
+    /**
+     * @brief Inserts a task into the heap, blocking while the heap is full.
+     *
+     * @param task The task to be enqueued.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void enqueue(const SharedTask &task) override;
+
+    /**
+     * @brief Removes the task with the highest priority, blocking while the heap is empty.
+     *
+     * @return The dequeued task.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    SharedTask dequeue() override;
+
+    /**
+     * @brief Inserts a batch of tasks with one lock acquisition per stored chunk.
+     *
+     * @param tasks The tasks to be enqueued.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void enqueue_bulk(std::span<const SharedTask> tasks) override;
+
+    /**
+     * @brief Removes up to `max` tasks in priority order, blocking until at least one is available.
+     *
+     * @param tasks Receives the dequeued tasks, highest priority first.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes up to `max` tasks in priority order without blocking.
+     *
+     * @param tasks Receives the dequeued tasks, highest priority first.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`, 0 if the heap is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t try_dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes the task with the highest priority without blocking.
+     *
+     * @return The dequeued task, or std::nullopt if the heap is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> try_dequeue() override;
+
+    /**
+     * @brief Removes the task with the highest priority, blocking at most for the given timeout.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return The dequeued task, or std::nullopt if the timeout expired.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> dequeue_for(std::chrono::milliseconds timeout) override;
+
+    /**
+     * @brief Changes the priority of the queued tasks with the given id in place.
+     *
+     * Every queued task carrying `id` gets the new priority and is sifted to its
+     * new heap position in O(log n).
+     *
+     * @param id The id of the task.
+     * @param priority The new priority.
+     * @return The number of tasks updated, 0 if no task with this id is queued.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t update_priority(int id, int priority);
+
+    /**
+     * @brief Gets the current number of tasks in the heap.
+     *
+     * @return The number of tasks currently stored in the heap.
+     */
+    [[nodiscard]] inline size_t size() const override
+    {
+        return data_->count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sets the scheduler running status.
+     *
+     * @param running The new status of the scheduler.
+     */
+    inline void set_scheduler_running(bool running) override
+    {
+        if (data_)
+            data_->scheduler_running_.store(running, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks if the scheduler is running.
+     *
+     * @return True if the scheduler is running, false otherwise.
+     */
+    [[nodiscard]] inline bool is_scheduler_running() const override
+    {
+        return data_ && data_->scheduler_running_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if the heap is empty.
+     *
+     * @return True if there are no tasks in the heap, false otherwise.
+     */
+    [[nodiscard]] inline bool empty() const override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Gets the name of the shared memory segment.
+     *
+     * @return The name of the shared memory segment.
+     */
+    [[nodiscard]] inline const std::string& name() const noexcept override
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Gets the capacity of the heap.
+     *
+     * @return The maximum number of tasks that can be stored in the heap.
+     */
+    [[nodiscard]] inline size_t capacity() const noexcept override
+    {
+        return capacity_;
+    }
+
+    /**
+     * @brief Checks whether the queue orders tasks by priority.
+     *
+     * @return Always true.
+     */
+    [[nodiscard]] inline bool is_priority_ordered() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Calls a visitor with every queued task in place, in heap array order.
+     *
+     * The first task visited is the next one to be dequeued; the others are not sorted.
+     *
+     * @param visitor Called once per queued task under the semaphore mutex.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void for_each_slot(const std::function<void(const TaskView&)>&) override;
+
+    /**
+     * @brief Copies the queued tasks out of the heap in dequeue order.
+     *
+     * Only the heap nodes are copied under the semaphore mutex and sorted; the
+     * tasks of the first tasks.size() nodes are then expanded.
+     *
+     * @param tasks Receives up to tasks.size() tasks, highest priority first.
+     * @return The number of tasks written to `tasks`.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t snapshot(std::span<SharedTask> tasks) override;
+
+private:
+
+    /**
+     * @brief Cleans up resources associated with the shared memory.
+     */
+    void cleanup();
+
+    /**
+     * @brief Ensures that the shared memory is attached.
+     *
+     * @throws std::runtime_error If the shared memory is not attached.
+     */
+    void validate() const;
+
+    /**
+     * @brief Maps the opened shared memory object and points the region pointers into it.
+     *
+     * @throws std::runtime_error If mmap fails.
+     */
+    void map();
+
+    /**
+     * @brief Checks whether heap entry `a` must be dequeued before `b`.
+     */
+    [[nodiscard]] static inline bool before(const HeapNode& a, const HeapNode& b) noexcept
+    {
+        return a.priority_ > b.priority_ || (a.priority_ == b.priority_ && a.order_ < b.order_);
+    }
+
+    /**
+     * @brief Stores a heap entry at the given index and records its position.
+     */
+    inline void place(size_t index, const HeapNode& node) noexcept
+    {
+        heap_[index] = node;
+        position_[node.slot_] = static_cast<uint32_t>(index);
+    }
+
+    /**
+     * @brief Moves the entry at `index` towards the root until the heap property holds.
+     */
+    void sift_up(size_t index) noexcept;
+
+    /**
+     * @brief Moves the entry at `index` towards the leaves until the heap property holds.
+     */
+    void sift_down(size_t index) noexcept;
+
+    /**
+     * @brief Gets the home bucket of an id in the id table.
+     */
+    [[nodiscard]] inline size_t bucket(int id) const noexcept
+    {
+        return (static_cast<uint32_t>(id) * 2654435761u) & table_mask_;
+    }
+
+    /**
+     * @brief Records that the task with `id` lives in `slot`.
+     */
+    void table_insert(int id, uint32_t slot) noexcept;
+
+    /**
+     * @brief Removes the entry mapping `id` to `slot`, shifting back the following entries.
+     */
+    void table_erase(int id, uint32_t slot) noexcept;
+
+    /**
+     * @brief Inserts a prefix of the batch under the semaphore mutex.
+     *
+     * @param tasks The tasks to be enqueued.
+     * @return The number of tasks stored, 0 if the heap is full.
+     */
+    size_t try_push(std::span<const SharedTask>);
+
+    /**
+     * @brief Pops up to tasks.size() tasks under the semaphore mutex.
+     *
+     * @param tasks Receives the dequeued tasks.
+     * @return The number of tasks retrieved, 0 if the heap is empty.
+     */
+    size_t try_pop(std::span<SharedTask>);
+
+    std::string name_;
+    size_t capacity_;
+    size_t table_mask_;
+    int fd_;
+    SharedHeapLayout* data_;
+    HeapNode* heap_;
+    CompactTask* tasks_;
+    uint32_t* position_;
+    uint32_t* free_;
+    IdEntry* table_;
+    DescriptionTable* descriptions_;
+
+    sem_t* mutex_sem_;
+
+    std::shared_ptr<Logger> logger_error_;
+    std::shared_ptr<Logger> logger_state_;
+};
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include "PosixSharedHeap/PosixSharedHeap.hpp"
+
+#include <algorithm>
+#include <vector>
+
+PosixSharedHeap::PosixSharedHeap(const std::string& name, size_t capacity)
+    : name_(name), capacity_(capacity), table_mask_(table_size(capacity) - 1), fd_(-1),
+    data_(nullptr), heap_(nullptr), tasks_(nullptr), position_(nullptr), free_(nullptr), table_(nullptr),
+    descriptions_(nullptr), mutex_sem_(SEM_FAILED)
+{
+    if (capacity == 0 || capacity > THROW_VALUE)
+        throw std::invalid_argument("Invalid value of capacity");
+    logger_error_ = std::make_shared<SharedLogger>(LOGS_DIR, ERROR_DIR, OverflowPolicy::COUNT, LogFormat::ERROR);
+    logger_state_ = std::make_shared<SharedLogger>(LOGS_DIR, STATE_DIR, OverflowPolicy::COUNT, STATE_LOG_FORMAT);
+}
+
+PosixSharedHeap::~PosixSharedHeap()
+{
+    cleanup();
+}
+
+void PosixSharedHeap::create()
+{
+    sem_unlink(std::string("/" + name_ + "_mut").c_str());
+
+    shm_unlink(name_.c_str());
+    fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (fd_ == -1)
+        throw std::runtime_error("Failed to create shared memory: " + std::string(strerror(errno)));
+
+    if (ftruncate(fd_, segment_size(capacity_)) == -1)
+    {
+        close(fd_);
+        throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+    }
+
+    map();
+
+    data_->capacity_ = capacity_;
+    data_->table_mask_ = table_mask_;
+    data_->scheduler_running_.store(false);
+    data_->count_.store(0);
+    data_->free_top_ = capacity_;
+    data_->next_order_ = 0;
+    data_->total_enqueued_ = 0;
+    data_->total_dequeued_ = 0;
+    data_->not_empty_.reset();
+    data_->not_full_.reset();
+
+    for (size_t i = 0; i < capacity_; ++i)
+        free_[i] = static_cast<uint32_t>(capacity_ - 1 - i);
+    for (size_t i = 0; i <= table_mask_; ++i)
+        table_[i].slot_ = EMPTY_SLOT;
+    descriptions_->reset(DescriptionTable::default_bytes(capacity_));
+
+    mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), O_CREAT | O_EXCL, 0666, 1);
+
+    if (mutex_sem_ == SEM_FAILED)
+        throw std::runtime_error("Failed to create semaphores");
+}
+
+void PosixSharedHeap::attach()
+{
+    if (fd_ == -1)
+    {
+        fd_ = shm_open(name_.c_str(), O_RDWR, 0666);
+        if (fd_ == -1)
+            throw std::runtime_error("shm_open failed: " + std::string(strerror(errno)));
+    }
+
+    void* address = mmap(nullptr, sizeof(SharedHeapLayout), PROT_READ, MAP_SHARED, fd_, 0);
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    const auto* header = static_cast<const SharedHeapLayout*>(address);
+    capacity_ = header->capacity_;
+    table_mask_ = header->table_mask_;
+    munmap(address, sizeof(SharedHeapLayout));
+
+    if (capacity_ == 0 || capacity_ > THROW_VALUE || table_mask_ + 1 != table_size(capacity_))
+        throw std::runtime_error("Shared memory header holds an invalid capacity");
+
+    map();
+
+    if (mutex_sem_ == SEM_FAILED)
+    {
+        mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), 0);
+        if (mutex_sem_ == SEM_FAILED)
+            throw std::runtime_error("Failed to open semaphores: " + std::string(strerror(errno)));
+    }
+}
+
+void PosixSharedHeap::map()
+{
+    void* address = mmap(nullptr, segment_size(capacity_), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    data_ = static_cast<SharedHeapLayout*>(address);
+    heap_ = reinterpret_cast<HeapNode*>(data_ + 1);
+    tasks_ = reinterpret_cast<CompactTask*>(heap_ + capacity_);
+    position_ = reinterpret_cast<uint32_t*>(tasks_ + capacity_);
+    free_ = position_ + capacity_;
+    table_ = reinterpret_cast<IdEntry*>(free_ + capacity_);
+    descriptions_ = reinterpret_cast<DescriptionTable*>(table_ + table_mask_ + 1);
+}
+
+void PosixSharedHeap::detach()
+{
+    if (data_)
+    {
+        munmap(data_, segment_size(capacity_));
+        data_ = nullptr;
+        heap_ = nullptr;
+        tasks_ = nullptr;
+        position_ = nullptr;
+        free_ = nullptr;
+        table_ = nullptr;
+        descriptions_ = nullptr;
+    }
+}
+
+void PosixSharedHeap::destroy()
+{
+    detach();
+    if (fd_ != -1)
+    {
+        close(fd_);
+        shm_unlink(name_.c_str());
+        fd_ = -1;
+    }
+
+    if (mutex_sem_ != SEM_FAILED)
+        sem_close(mutex_sem_);
+    mutex_sem_ = SEM_FAILED;
+
+    sem_unlink(std::string("/" + name_ + "_mut").c_str());
+}
+
+void PosixSharedHeap::enqueue(const SharedTask& task)
+{
+    enqueue_bulk(std::span<const SharedTask>(&task, 1));
+}
+
+SharedTask PosixSharedHeap::dequeue()
+{
+    SharedTask task;
+    dequeue_bulk(std::span<SharedTask>(&task, 1), 1);
+    return task;
+}
+
+void PosixSharedHeap::enqueue_bulk(std::span<const SharedTask> tasks)
+{
+    size_t done = 0;
+
+    while (done < tasks.size())
+    {
+        size_t stored = try_push(tasks.subspan(done));
+        if (stored == 0)
+        {
+            data_->not_full_.wait([this, &tasks, done] 
+            { 
+                return size() < capacity_ && descriptions_->available(tasks[done].description_); 
+            });
+            continue;
+        }
+
+        done += stored;
+        data_->not_empty_.notify(stored);
+    }
+}
+
+size_t PosixSharedHeap::dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    if (tasks.empty() || max == 0)
+        return 0;
+
+    while (true)
+    {
+        if (size_t taken = try_dequeue_bulk(tasks, max))
+            return taken;
+
+        data_->not_empty_.wait([this] { return size() > 0; });
+    }
+}
+
+size_t PosixSharedHeap::try_dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    tasks = tasks.first(std::min(tasks.size(), max));
+    if (tasks.empty())
+        return 0;
+
+    size_t taken = try_pop(tasks);
+    if (taken != 0)
+        data_->not_full_.notify(taken);
+    return taken;
+}
+
+std::optional<SharedTask> PosixSharedHeap::try_dequeue()
+{
+    SharedTask task;
+    if (try_dequeue_bulk(std::span<SharedTask>(&task, 1), 1) == 0)
+        return std::nullopt;
+    return task;
+}
+
+std::optional<SharedTask> PosixSharedHeap::dequeue_for(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true)
+    {
+        if (auto task = try_dequeue())
+            return task;
+        if (std::chrono::steady_clock::now() >= deadline)
+            return std::nullopt;
+
+        data_->not_empty_.wait([this] { return size() > 0; }, deadline);
+    }
+}
+
+size_t PosixSharedHeap::update_priority(int id, int priority)
+{
+    validate();
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t updated = 0;
+    for (size_t i = bucket(id); table_[i].slot_ != EMPTY_SLOT; i = (i + 1) & table_mask_)
+    {
+        if (table_[i].id_ != id)
+            continue;
+
+        uint32_t slot = table_[i].slot_;
+        size_t index = position_[slot];
+        int previous = heap_[index].priority_;
+
+        heap_[index].priority_ = priority;
+        tasks_[slot].priority_ = priority;
+        if (priority > previous)
+            sift_up(index);
+        else
+            sift_down(index);
+        ++updated;
+    }
+
+    if (updated != 0)
+        LOG_TRACE_EVENT(logger_state_, "Updated priority of task with id: {} to {}", id, priority);
+
+    sem_post(mutex_sem_);
+    return updated;
+}
+
+void PosixSharedHeap::for_each_slot(const std::function<void(const TaskView&)>& visitor)
+{
+    validate();
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed during visit");
+
+    try
+    {
+        size_t count = data_->count_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+            visitor(descriptions_->view(tasks_[heap_[i].slot_]));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Error during visit: " + std::string(e.what()));
+        sem_post(mutex_sem_);
+        throw;
+    }
+
+    sem_post(mutex_sem_);
+}
+
+size_t PosixSharedHeap::snapshot(std::span<SharedTask> tasks)
+{
+    validate();
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed during snapshot");
+
+    size_t count = 0;
+    try
+    {
+        std::vector<HeapNode> nodes(heap_, heap_ + data_->count_.load(std::memory_order_relaxed));
+        count = std::min(tasks.size(), nodes.size());
+        std::partial_sort(nodes.begin(), nodes.begin() + count, nodes.end(), before);
+
+        for (size_t i = 0; i < count; ++i)
+            descriptions_->peek(tasks_[nodes[i].slot_], tasks[i]);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Error during snapshot: " + std::string(e.what()));
+        sem_post(mutex_sem_);
+        throw;
+    }
+
+    sem_post(mutex_sem_);
+    return count;
+}
+
+void PosixSharedHeap::sift_up(size_t index) noexcept
+{
+    HeapNode node = heap_[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!before(node, heap_[parent]))
+            break;
+        place(index, heap_[parent]);
+        index = parent;
+    }
+    place(index, node);
+}
+
+void PosixSharedHeap::sift_down(size_t index) noexcept
+{
+    size_t count = data_->count_.load(std::memory_order_relaxed);
+    HeapNode node = heap_[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= count)
+            break;
+        if (child + 1 < count && before(heap_[child + 1], heap_[child]))
+            ++child;
+        if (!before(heap_[child], node))
+            break;
+        place(index, heap_[child]);
+        index = child;
+    }
+    place(index, node);
+}
+
+void PosixSharedHeap::table_insert(int id, uint32_t slot) noexcept
+{
+    size_t i = bucket(id);
+    while (table_[i].slot_ != EMPTY_SLOT)
+        i = (i + 1) & table_mask_;
+    table_[i] = IdEntry{id, slot};
+}
+
+void PosixSharedHeap::table_erase(int id, uint32_t slot) noexcept
+{
+    size_t hole = bucket(id);
+    while (table_[hole].slot_ != slot)
+        hole = (hole + 1) & table_mask_;
+
+    for (size_t i = (hole + 1) & table_mask_; table_[i].slot_ != EMPTY_SLOT; i = (i + 1) & table_mask_)
+    {
+        size_t home = bucket(table_[i].id_);
+        if (((i - home) & table_mask_) >= ((i - hole) & table_mask_))
+        {
+            table_[hole] = table_[i];
+            hole = i;
+        }
+    }
+    table_[hole].slot_ = EMPTY_SLOT;
+}
+
+size_t PosixSharedHeap::try_push(std::span<const SharedTask> tasks)
+{
+    validate();
+
+    if (data_->count_.load(std::memory_order_relaxed) >= capacity_)
+        return 0;
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t count = data_->count_.load(std::memory_order_relaxed);
+    size_t stored = std::min(tasks.size(), capacity_ - count);
+
+    for (size_t i = 0; i < stored; ++i)
+    {
+        uint32_t slot = free_[data_->free_top_ - 1];
+        if (!descriptions_->store(tasks[i], tasks_[slot]))
+        {
+            stored = i;
+            break;
+        }
+        --data_->free_top_;
+        table_insert(tasks[i].id_, slot);
+
+        place(count, HeapNode{tasks[i].priority_, slot, data_->next_order_++});
+        data_->count_.store(++count, std::memory_order_relaxed);
+        sift_up(count - 1);
+    }
+    data_->total_enqueued_ += stored;
+
+    if (stored == 1)
+        LOG_TRACE_EVENT(logger_state_, "Enqueued task with id: {}", tasks[0].id_);
+    else if (stored > 1)
+        LOG_TRACE_EVENT(logger_state_, "Enqueued {} tasks starting with id: {}", stored, tasks[0].id_);
+
+    sem_post(mutex_sem_);
+    return stored;
+}
+
+size_t PosixSharedHeap::try_pop(std::span<SharedTask> tasks)
+{
+    validate();
+
+    if (data_->count_.load(std::memory_order_relaxed) == 0)
+        return 0;
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t count = data_->count_.load(std::memory_order_relaxed);
+    size_t taken = std::min(tasks.size(), count);
+
+    for (size_t i = 0; i < taken; ++i)
+    {
+        uint32_t slot = heap_[0].slot_;
+        descriptions_->load(tasks_[slot], tasks[i]);
+        table_erase(tasks[i].id_, slot);
+        free_[data_->free_top_++] = slot;
+
+        data_->count_.store(--count, std::memory_order_relaxed);
+        if (count != 0)
+        {
+            place(0, heap_[count]);
+            sift_down(0);
+        }
+    }
+    data_->total_dequeued_ += taken;
+
+    if (taken == 1)
+        LOG_TRACE_EVENT(logger_state_, "Dequeued task with id: {}", tasks[0].id_);
+    else if (taken > 1)
+        LOG_TRACE_EVENT(logger_state_, "Dequeued {} tasks starting with id: {}", taken, tasks[0].id_);
+
+    sem_post(mutex_sem_);
+    return taken;
+}
+
+void PosixSharedHeap::cleanup()
+{
+    try
+    {
+        destroy();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Failed to clean up shared memory: " + std::string(e.what()));
+    }
+    catch (...)
+    {
+        LOG_ERROR(logger_error_, "Unknown exception occurred during cleanup.");
+    }
+}
+
+void PosixSharedHeap::validate() const
+{
+    if (!data_)
+        throw std::runtime_error("Shared memory not attached");
+}
\ No newline at end of file
@@ -0,0 +1,453 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+#include <Futex/Futex.hpp>
+#include <Logger/SharedLogChannel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <signal.h>
+#include <span>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define COUNT_LANES 8
+#define MAX_LANES 64
+
+/**
+ * @enum LaneMerge
+ * @brief Selects how the consumer merges the producer lanes.
+ *
+ * - ROUND_ROBIN: one task from each non-empty lane in turn.
+ * - PRIORITY: the task with the highest priority among the lane heads; ties go
+ *   to the lane following the one served last.
+ */
+enum class LaneMerge
+{
+    ROUND_ROBIN,
+    PRIORITY
+};
+
+/**
+ * @class PosixSharedLanes
+ * @brief Implements the SharedMemory interface as per-producer SPSC lanes in POSIX shared memory.
+ *
+ * Every producer (a server worker thread or a client process) registers a lane of its
+ * own and is the only writer of that lane's tail; the consumer is the only writer of
+ * its head. Publishing a task is a plain store, so producers never execute an atomic
+ * read-modify-write and never contend with each other. Consumers are serialized by a
+ * spin lock and merge the lanes according to LaneMerge.
+ *
+ * Lanes hold full SharedTask entries: interning descriptions in a shared table would
+ * put a lock back on the producer path.
+ *
+ * Lane ownership is recorded as the owner's process id, so a lane of a process that
+ * died is taken over by the next registration.
+ */
+class PosixSharedLanes : public SharedMemory
+{
+public:
+
+    /**
+     * @class Producer
+     * @brief A registered lane; releases it on destruction.
+     *
+     * Must be used by one thread at a time.
+     */
+    class Producer
+    {
+    public:
+        Producer(Producer&& other) noexcept : lanes_(other.lanes_), lane_(other.lane_)
+        {
+            other.lanes_ = nullptr;
+        }
+
+        Producer(const Producer&) = delete;
+        Producer& operator=(const Producer&) = delete;
+        Producer& operator=(Producer&&) = delete;
+
+        ~Producer()
+        {
+            if (lanes_)
+                lanes_->release_lane(lane_);
+        }
+
+        /**
+         * @brief Appends a task to the lane, blocking while the lane is full.
+         *
+         * @param task The task to be enqueued.
+         */
+        inline void enqueue(const SharedTask& task)
+        {
+            lanes_->push(lane_, std::span<const SharedTask>(&task, 1));
+        }
+
+        /**
+         * @brief Appends a batch of tasks to the lane, blocking while the lane is full.
+         *
+         * @param tasks The tasks to be enqueued, in order.
+         */
+        inline void enqueue_bulk(std::span<const SharedTask> tasks)
+        {
+            lanes_->push(lane_, tasks);
+        }
+
+        /**
+         * @brief Gets the index of the registered lane.
+         */
+        [[nodiscard]] inline size_t lane() const noexcept
+        {
+            return lane_;
+        }
+
+    private:
+        friend class PosixSharedLanes;
+
+        Producer(PosixSharedLanes* lanes, size_t lane) : lanes_(lanes), lane_(lane) {}
+
+        PosixSharedLanes* lanes_;
+        size_t lane_;
+    };
+
+    /**
+     * @brief Constructor for PosixSharedLanes.
+     *
+     * @param name The name of the shared memory segment.
+     * @param lanes The number of producer lanes.
+     * @param lane_capacity The maximum number of tasks per lane.
+     * @param merge How the consumer merges the lanes (default: LaneMerge::PRIORITY).
+     * @throws std::invalid_argument If the number of lanes or the lane capacity is invalid.
+     */
+    PosixSharedLanes(const std::string&, size_t = COUNT_LANES, size_t = COUNT_TASKS,
+        LaneMerge = LaneMerge::PRIORITY);
+
+    /**
+     * @brief Destructor for PosixSharedLanes.
+     *
+     * Cleans up resources associated with the shared memory segment.
+     */
+    ~PosixSharedLanes() override;
+
+    /**
+     * @struct Lane
+     * @brief Control block of one SPSC lane.
+     *
+     * `owner_` is the process id of the registered producer, 0 if the lane is free.
+     * The producer owns `tail_` and its cached copy of the head, the consumer owns
+     * `head_`; both are monotonically increasing positions.
+     */
+    struct Lane
+    {
+        alignas(CACHE_LINE) std::atomic<uint32_t> owner_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> tail_;
+        size_t cached_head_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> head_;
+    };
+
+    /**
+     * @struct SharedLanesLayout
+     * @brief Defines the header of the shared memory segment.
+     *
+     * The header is followed by `lanes_` Lane control blocks and `lanes_ * lane_capacity_`
+     * SharedTask slots, lane by lane.
+     */
+    struct SharedLanesLayout
+    {
+        alignas(CACHE_LINE) size_t lanes_;
+        size_t lane_capacity_;
+        LaneMerge merge_;
+        std::atomic<bool> scheduler_running_;
+
+        alignas(CACHE_LINE) std::atomic<uint32_t> consumer_lock_;
+        size_t cursor_;
+
+        alignas(CACHE_LINE) FutexEvent not_empty_;
+        FutexEvent not_full_;
+    };
+
+    /**
+     * @brief Computes the size of a segment with the given geometry.
+     *
+     * @param lanes The number of lanes.
+     * @param lane_capacity The number of slots per lane.
+     * @return The size in bytes of the header, the lane control blocks and the slots.
+     */
+    [[nodiscard]] static constexpr size_t segment_size(size_t lanes, size_t lane_capacity) noexcept
+    {
+        return sizeof(SharedLanesLayout) + lanes * sizeof(Lane) + lanes * lane_capacity * sizeof(SharedTask);
+    }
+
+    /**
+     * @brief Creates a new shared memory segment.
+     *
+     * @throws std::runtime_error If shared memory creation fails.
+     */
+    void create() override;
+
+    /**
+     * @brief Attaches to an existing shared memory segment.
+     *
+     * Reads the lane geometry and merge policy from the segment header.
+     * @throws std::runtime_error If attachment fails.
+     */
+    void attach() override;
+
+    /**
+     * @brief Detaches from the shared memory segment.
+     */
+    void detach() override;
+
+    /**
+     * @brief Destroys the shared memory segment.
+     */
+    void destroy() override;
+
+    /**
+     * @brief Registers a lane for the calling producer.
+     *
+     * @return The registered lane.
+     * @throws std::runtime_error If every lane is registered by a live producer.
+     */
+    Producer register_producer();
+
+    /**
+     * @brief Enqueues a task through a lane registered for the duration of the call.
+     *
+     * Long-lived producers should keep a Producer from register_producer() instead.
+     *
+     * @param task The task to be enqueued.
+     */
+    void enqueue(const SharedTask &task) override;
+
+    /**
+     * @brief Removes the next task according to the merge policy, blocking while all lanes are empty.
+     *
+     * @return The dequeued task.
+     */
+    SharedTask dequeue() override;
+
+    /**
+     * @brief Enqueues a batch of tasks through a lane registered for the duration of the call.
+     *
+     * @param tasks The tasks to be enqueued, in order.
+     */
+    void enqueue_bulk(std::span<const SharedTask> tasks) override;
+
+    /**
+     * @brief Removes up to `max` tasks, blocking until at least one is available.
+     *
+     * @param tasks Receives the dequeued tasks, in merge order.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`.
+     */
+    size_t dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes up to `max` tasks without blocking.
+     *
+     * @param tasks Receives the dequeued tasks, in merge order.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`, 0 if all lanes are empty.
+     */
+    size_t try_dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes the next task without blocking.
+     *
+     * @return The dequeued task, or std::nullopt if all lanes are empty.
+     */
+    std::optional<SharedTask> try_dequeue() override;
+
+    /**
+     * @brief Removes the next task, blocking at most for the given timeout.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return The dequeued task, or std::nullopt if the timeout expired.
+     */
+    std::optional<SharedTask> dequeue_for(std::chrono::milliseconds timeout) override;
+
+    /**
+     * @brief Gets the current number of tasks in all lanes.
+     *
+     * @return The number of tasks currently stored.
+     */
+    [[nodiscard]] size_t size() const override;
+
+    /**
+     * @brief Sets the scheduler running status.
+     *
+     * @param running The new status of the scheduler.
+     */
+    inline void set_scheduler_running(bool running) override
+    {
+        if (data_)
+            data_->scheduler_running_.store(running, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks if the scheduler is running.
+     *
+     * @return True if the scheduler is running, false otherwise.
+     */
+    [[nodiscard]] inline bool is_scheduler_running() const override
+    {
+        return data_ && data_->scheduler_running_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if all lanes are empty.
+     *
+     * @return True if there are no tasks in any lane, false otherwise.
+     */
+    [[nodiscard]] inline bool empty() const override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Gets the name of the shared memory segment.
+     *
+     * @return The name of the shared memory segment.
+     */
+    [[nodiscard]] inline const std::string& name() const noexcept override
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Gets the total capacity of all lanes.
+     *
+     * @return The number of lanes times the lane capacity.
+     */
+    [[nodiscard]] inline size_t capacity() const noexcept override
+    {
+        return lanes_ * lane_capacity_;
+    }
+
+    /**
+     * @brief Gets the number of lanes.
+     */
+    [[nodiscard]] inline size_t lanes() const noexcept
+    {
+        return lanes_;
+    }
+
+    /**
+     * @brief Checks whether the consumer applies priorities itself.
+     *
+     * @return True with LaneMerge::PRIORITY, false with LaneMerge::ROUND_ROBIN.
+     */
+    [[nodiscard]] inline bool is_priority_ordered() const noexcept override
+    {
+        return merge_ == LaneMerge::PRIORITY;
+    }
+
+    /**
+     * @brief Calls a visitor with every queued task in place, lane by lane.
+     *
+     * Holds the consumer lock, so producers keep appending while the visitor runs.
+     *
+     * @param visitor Called once per queued task.
+     */
+    void for_each_slot(const std::function<void(const TaskView&)>&) override;
+
+    /**
+     * @brief Copies the queued tasks out lane by lane, with at most two memcpy calls per lane.
+     *
+     * @param tasks Receives up to tasks.size() tasks.
+     * @return The number of tasks written to `tasks`.
+     */
+    size_t snapshot(std::span<SharedTask> tasks) override;
+
+private:
+
+    /**
+     * @brief Cleans up resources associated with the shared memory.
+     */
+    void cleanup();
+
+    /**
+     * @brief Ensures that the shared memory is attached.
+     *
+     * @throws std::runtime_error If the shared memory is not attached.
+     */
+    void validate() const;
+
+    /**
+     * @brief Maps the opened shared memory object and points the lane and slot pointers into it.
+     *
+     * @throws std::runtime_error If mmap fails.
+     */
+    void map();
+
+    /**
+     * @brief Acquires the spin lock that serializes consumers.
+     */
+    void lock_consumers() noexcept;
+
+    /**
+     * @brief Releases the spin lock that serializes consumers.
+     */
+    void unlock_consumers() noexcept;
+
+    /**
+     * @brief Claims a free lane, or a lane whose owner process is gone.
+     *
+     * @return The lane index, or lanes_ if no lane could be claimed.
+     */
+    size_t claim_lane();
+
+    /**
+     * @brief Returns a lane to the free pool; queued tasks stay in it.
+     */
+    void release_lane(size_t lane) noexcept;
+
+    /**
+     * @brief Appends tasks to a lane owned by the caller, blocking while it is full.
+     */
+    void push(size_t lane, std::span<const SharedTask> tasks);
+
+    /**
+     * @brief Appends as many tasks as fit into a lane owned by the caller.
+     *
+     * @return The number of tasks stored, 0 if the lane is full.
+     */
+    size_t try_push(size_t lane, std::span<const SharedTask> tasks) noexcept;
+
+    /**
+     * @brief Gets the number of free slots of a lane as seen by its producer.
+     */
+    [[nodiscard]] inline size_t free_slots(size_t lane) const noexcept
+    {
+        const Lane& control = lanes_control_[lane];
+        return lane_capacity_ - (control.tail_.load(std::memory_order_relaxed) -
+            control.head_.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Gets a slot of a lane.
+     */
+    [[nodiscard]] inline SharedTask& slot(size_t lane, size_t position) noexcept
+    {
+        return slots_[lane * lane_capacity_ + position % lane_capacity_];
+    }
+
+    std::string name_;
+    size_t lanes_;
+    size_t lane_capacity_;
+    LaneMerge merge_;
+    int fd_;
+    SharedLanesLayout* data_;
+    Lane* lanes_control_;
+    SharedTask* slots_;
+
+    std::shared_ptr<Logger> logger_error_;
+};
\ No newline at end of file
@@ -0,0 +1,393 @@
+#include "PosixSharedLanes/PosixSharedLanes.hpp"
+
+#include <thread>
+
+PosixSharedLanes::PosixSharedLanes(const std::string& name, size_t lanes, size_t lane_capacity, LaneMerge merge)
+    : name_(name), lanes_(lanes), lane_capacity_(lane_capacity), merge_(merge), fd_(-1), data_(nullptr),
+    lanes_control_(nullptr), slots_(nullptr)
+{
+    if (lanes == 0 || lanes > MAX_LANES)
+        throw std::invalid_argument("Invalid number of lanes");
+    if (lane_capacity == 0 || lanes * lane_capacity > THROW_VALUE)
+        throw std::invalid_argument("Invalid value of capacity");
+    logger_error_ = std::make_shared<SharedLogger>(LOGS_DIR, ERROR_DIR, OverflowPolicy::COUNT, LogFormat::ERROR);
+}
+
+PosixSharedLanes::~PosixSharedLanes()
+{
+    cleanup();
+}
+
+void PosixSharedLanes::create()
+{
+    shm_unlink(name_.c_str());
+    fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (fd_ == -1)
+        throw std::runtime_error("Failed to create shared memory: " + std::string(strerror(errno)));
+
+    if (ftruncate(fd_, segment_size(lanes_, lane_capacity_)) == -1)
+    {
+        close(fd_);
+        throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+    }
+
+    map();
+
+    data_->lanes_ = lanes_;
+    data_->lane_capacity_ = lane_capacity_;
+    data_->merge_ = merge_;
+    data_->scheduler_running_.store(false);
+    data_->consumer_lock_.store(0);
+    data_->cursor_ = 0;
+    data_->not_empty_.reset();
+    data_->not_full_.reset();
+
+    for (size_t i = 0; i < lanes_; ++i)
+    {
+        lanes_control_[i].owner_.store(0);
+        lanes_control_[i].tail_.store(0);
+        lanes_control_[i].cached_head_ = 0;
+        lanes_control_[i].head_.store(0);
+    }
+}
+
+void PosixSharedLanes::attach()
+{
+    if (fd_ == -1)
+    {
+        fd_ = shm_open(name_.c_str(), O_RDWR, 0666);
+        if (fd_ == -1)
+            throw std::runtime_error("shm_open failed: " + std::string(strerror(errno)));
+    }
+
+    void* address = mmap(nullptr, sizeof(SharedLanesLayout), PROT_READ, MAP_SHARED, fd_, 0);
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    const auto* header = static_cast<const SharedLanesLayout*>(address);
+    lanes_ = header->lanes_;
+    lane_capacity_ = header->lane_capacity_;
+    merge_ = header->merge_;
+    munmap(address, sizeof(SharedLanesLayout));
+
+    if (lanes_ == 0 || lanes_ > MAX_LANES || lane_capacity_ == 0 || lanes_ * lane_capacity_ > THROW_VALUE)
+        throw std::runtime_error("Shared memory header holds an invalid capacity");
+
+    map();
+}
+
+void PosixSharedLanes::map()
+{
+    void* address = mmap(nullptr, segment_size(lanes_, lane_capacity_), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    data_ = static_cast<SharedLanesLayout*>(address);
+    lanes_control_ = reinterpret_cast<Lane*>(data_ + 1);
+    slots_ = reinterpret_cast<SharedTask*>(lanes_control_ + lanes_);
+}
+
+void PosixSharedLanes::detach()
+{
+    if (data_)
+    {
+        munmap(data_, segment_size(lanes_, lane_capacity_));
+        data_ = nullptr;
+        lanes_control_ = nullptr;
+        slots_ = nullptr;
+    }
+}
+
+void PosixSharedLanes::destroy()
+{
+    detach();
+    if (fd_ != -1)
+    {
+        close(fd_);
+        shm_unlink(name_.c_str());
+        fd_ = -1;
+    }
+}
+
+PosixSharedLanes::Producer PosixSharedLanes::register_producer()
+{
+    validate();
+
+    size_t lane = claim_lane();
+    if (lane == lanes_)
+        throw std::runtime_error("No free lane in shared memory");
+    return Producer(this, lane);
+}
+
+void PosixSharedLanes::lock_consumers() noexcept
+{
+    while (data_->consumer_lock_.exchange(1, std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
+void PosixSharedLanes::unlock_consumers() noexcept
+{
+    data_->consumer_lock_.store(0, std::memory_order_release);
+}
+
+size_t PosixSharedLanes::claim_lane()
+{
+    auto pid = static_cast<uint32_t>(getpid());
+    size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % lanes_;
+
+    for (size_t i = 0; i < lanes_; ++i)
+    {
+        size_t lane = (start + i) % lanes_;
+        uint32_t owner = 0;
+        if (lanes_control_[lane].owner_.compare_exchange_strong(owner, pid, std::memory_order_acquire))
+            return lane;
+    }
+
+    for (size_t lane = 0; lane < lanes_; ++lane)
+    {
+        uint32_t owner = lanes_control_[lane].owner_.load(std::memory_order_relaxed);
+        if (owner != 0 && owner != pid && kill(static_cast<pid_t>(owner), 0) == -1 && errno == ESRCH &&
+            lanes_control_[lane].owner_.compare_exchange_strong(owner, pid, std::memory_order_acquire))
+            return lane;
+    }
+    return lanes_;
+}
+
+void PosixSharedLanes::release_lane(size_t lane) noexcept
+{
+    if (data_)
+        lanes_control_[lane].owner_.store(0, std::memory_order_release);
+}
+
+void PosixSharedLanes::enqueue(const SharedTask& task)
+{
+    enqueue_bulk(std::span<const SharedTask>(&task, 1));
+}
+
+void PosixSharedLanes::enqueue_bulk(std::span<const SharedTask> tasks)
+{
+    validate();
+
+    size_t lane = claim_lane();
+    while (lane == lanes_)
+    {
+        std::this_thread::yield();
+        lane = claim_lane();
+    }
+
+    try
+    {
+        push(lane, tasks);
+    }
+    catch (...)
+    {
+        release_lane(lane);
+        throw;
+    }
+    release_lane(lane);
+}
+
+void PosixSharedLanes::push(size_t lane, std::span<const SharedTask> tasks)
+{
+    size_t done = 0;
+
+    while (done < tasks.size())
+    {
+        size_t stored = try_push(lane, tasks.subspan(done));
+        if (stored == 0)
+        {
+            data_->not_full_.wait([this, lane] { return free_slots(lane) > 0; });
+            continue;
+        }
+
+        done += stored;
+        data_->not_empty_.notify(stored);
+    }
+}
+
+size_t PosixSharedLanes::try_push(size_t lane, std::span<const SharedTask> tasks) noexcept
+{
+    Lane& control = lanes_control_[lane];
+    size_t tail = control.tail_.load(std::memory_order_relaxed);
+
+    if (lane_capacity_ - (tail - control.cached_head_) < tasks.size())
+        control.cached_head_ = control.head_.load(std::memory_order_acquire);
+
+    size_t stored = std::min(tasks.size(), lane_capacity_ - (tail - control.cached_head_));
+    for (size_t i = 0; i < stored; ++i)
+        slot(lane, tail + i) = tasks[i];
+
+    control.tail_.store(tail + stored, std::memory_order_release);
+    return stored;
+}
+
+SharedTask PosixSharedLanes::dequeue()
+{
+    SharedTask task;
+    dequeue_bulk(std::span<SharedTask>(&task, 1), 1);
+    return task;
+}
+
+size_t PosixSharedLanes::dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    if (tasks.empty() || max == 0)
+        return 0;
+
+    while (true)
+    {
+        if (size_t taken = try_dequeue_bulk(tasks, max))
+            return taken;
+
+        data_->not_empty_.wait([this] { return size() > 0; });
+    }
+}
+
+size_t PosixSharedLanes::try_dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    validate();
+
+    tasks = tasks.first(std::min(tasks.size(), max));
+    if (tasks.empty())
+        return 0;
+
+    lock_consumers();
+
+    size_t heads[MAX_LANES];
+    size_t tails[MAX_LANES];
+    for (size_t lane = 0; lane < lanes_; ++lane)
+    {
+        heads[lane] = lanes_control_[lane].head_.load(std::memory_order_relaxed);
+        tails[lane] = lanes_control_[lane].tail_.load(std::memory_order_acquire);
+    }
+
+    size_t taken = 0;
+    size_t cursor = data_->cursor_;
+    while (taken < tasks.size())
+    {
+        size_t selected = lanes_;
+        for (size_t i = 0; i < lanes_; ++i)
+        {
+            size_t lane = (cursor + i) % lanes_;
+            if (heads[lane] == tails[lane])
+                continue;
+            if (merge_ == LaneMerge::ROUND_ROBIN)
+            {
+                selected = lane;
+                break;
+            }
+            if (selected == lanes_ || slot(lane, heads[lane]).priority_ > slot(selected, heads[selected]).priority_)
+                selected = lane;
+        }
+        if (selected == lanes_)
+            break;
+
+        tasks[taken++] = slot(selected, heads[selected]++);
+        cursor = (selected + 1) % lanes_;
+    }
+
+    for (size_t lane = 0; lane < lanes_; ++lane)
+        lanes_control_[lane].head_.store(heads[lane], std::memory_order_release);
+    data_->cursor_ = cursor;
+    unlock_consumers();
+
+    if (taken != 0)
+        data_->not_full_.notify(lanes_);
+    return taken;
+}
+
+std::optional<SharedTask> PosixSharedLanes::try_dequeue()
+{
+    SharedTask task;
+    if (try_dequeue_bulk(std::span<SharedTask>(&task, 1), 1) == 0)
+        return std::nullopt;
+    return task;
+}
+
+std::optional<SharedTask> PosixSharedLanes::dequeue_for(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true)
+    {
+        if (auto task = try_dequeue())
+            return task;
+        if (std::chrono::steady_clock::now() >= deadline)
+            return std::nullopt;
+
+        data_->not_empty_.wait([this] { return size() > 0; }, deadline);
+    }
+}
+
+size_t PosixSharedLanes::size() const
+{
+    size_t count = 0;
+    for (size_t lane = 0; lane < lanes_; ++lane)
+        count += lanes_control_[lane].tail_.load(std::memory_order_relaxed) -
+            lanes_control_[lane].head_.load(std::memory_order_relaxed);
+    return count;
+}
+
+void PosixSharedLanes::for_each_slot(const std::function<void(const TaskView&)>& visitor)
+{
+    validate();
+
+    lock_consumers();
+    try
+    {
+        for (size_t lane = 0; lane < lanes_; ++lane)
+        {
+            size_t tail = lanes_control_[lane].tail_.load(std::memory_order_acquire);
+            for (size_t position = lanes_control_[lane].head_.load(std::memory_order_relaxed); position != tail; ++position)
+                visitor(view_of(slot(lane, position)));
+        }
+    }
+    catch (...)
+    {
+        unlock_consumers();
+        throw;
+    }
+    unlock_consumers();
+}
+
+size_t PosixSharedLanes::snapshot(std::span<SharedTask> tasks)
+{
+    validate();
+
+    size_t count = 0;
+    lock_consumers();
+    for (size_t lane = 0; lane < lanes_ && count < tasks.size(); ++lane)
+    {
+        size_t head = lanes_control_[lane].head_.load(std::memory_order_relaxed);
+        size_t queued = std::min(lanes_control_[lane].tail_.load(std::memory_order_acquire) - head, tasks.size() - count);
+
+        size_t first = std::min(queued, lane_capacity_ - head % lane_capacity_);
+        std::memcpy(tasks.data() + count, &slot(lane, head), first * sizeof(SharedTask));
+        std::memcpy(tasks.data() + count + first, &slot(lane, 0), (queued - first) * sizeof(SharedTask));
+        count += queued;
+    }
+    unlock_consumers();
+    return count;
+}
+
+void PosixSharedLanes::cleanup()
+{
+    try
+    {
+        destroy();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Failed to clean up shared memory: " + std::string(e.what()));
+    }
+    catch (...)
+    {
+        LOG_ERROR(logger_error_, "Unknown exception occurred during cleanup.");
+    }
+}
+
+void PosixSharedLanes::validate() const
+{
+    if (!data_)
+        throw std::runtime_error("Shared memory not attached");
+}
\ No newline at end of file
@@ -1,20 +1,64 @@
 #pragma once
 
 #include <SharedMemory/SharedMemory.hpp>
-#include <Logger/Logger.hpp>
+#include <Doorbell/Doorbell.hpp>
+#include <SharedMemory/DescriptionTable.hpp>
+#include <SharedMemory/StatisticsPage.hpp>
+#include <Futex/Futex.hpp>
+#include <Logger/SharedLogChannel.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <fcntl.h>
 #include <mutex>
+#include <optional>
 #include <semaphore.h>
+#include <span>
 #include <stdexcept>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
-#define COUNT_TASKS 100
-#define THROW_VALUE 10000
-#define ERROR_DIR "error_log"
+#define QUEUE_MAGIC 0x5441534b51554555ull
+#define SYNC_PERIOD_MS 100
+
+/**
+ * @enum QueueMode
+ * @brief Selects the synchronization scheme of the shared memory queue.
+ *
+ * - LOCKING: every operation is serialized through a named semaphore mutex.
+ * - LOCK_FREE: producers and consumers claim slots with per-slot sequence
+ *   numbers and only enter the kernel (futex) when the queue is full or empty.
+ *   Descriptions are interned and released with atomic operations on the
+ *   DescriptionTable; counting a batch serializes on the seqlock of the
+ *   statistics page for a few stores.
+ */
+enum class QueueMode 
+{
+    LOCKING,
+    LOCK_FREE
+};
+
+/**
+ * @enum SyncPolicy
+ * @brief Selects when a file-backed queue flushes its mapping to disk with msync.
+ *
+ * - NONE: never; the kernel writes pages back on its own. Survives process crashes only.
+ * - PERIODIC: after a commit if SYNC_PERIOD_MS passed since the last flush.
+ * - PER_BATCH: before and after every commit record, so a committed batch survives power loss.
+ *   Only the pages of the slots and description records written by the batch and of
+ *   the header are flushed.
+ */
+enum class SyncPolicy 
+{
+    NONE,
+    PERIODIC,
+    PER_BATCH
+};
 
 /**
  * @class PosixSharedMemory
@@ -23,8 +67,19 @@
  * This class provides concrete implementations for managing shared memory using
  * POSIX APIs. It supports operations such as creating, attaching, detaching,
  * and destroying shared memory, as well as enqueueing and dequeueing tasks. It
- * also includes synchronization mechanisms (semaphores) to ensure thread-safe
- * access to the shared memory.
+ * also includes synchronization mechanisms (a semaphore mutex and futex words
+ * in the segment) to ensure thread-safe access to the shared memory.
+ *
+ * A queue constructed with a file path lives in an mmap'ed file instead of a POSIX
+ * shared memory object and keeps its backlog across restarts. Its commit records are
+ * the monotonic total_enqueued_/total_dequeued_ counters: slots are written first and
+ * the counter is advanced afterwards, so on reopening only committed tasks are
+ * recovered. Dequeued tasks whose commit was lost are delivered again.
+ *
+ * A failed flush before the commit record aborts an enqueue with std::runtime_error
+ * and leaves the queue unchanged. A failed flush after it is only logged: the batch
+ * is committed in the mapping and is returned to the caller, only its durability
+ * across a power loss is in doubt. The semaphore mutex is released on every path.
  */
 class PosixSharedMemory : public SharedMemory 
 {
@@ -35,11 +90,28 @@ public:
      * 
      * Initializes the shared memory object with the given name and capacity.
      * 
+     * A power-of-two capacity lets the queue wrap indices with a mask instead of a modulo.
+     *
      * @param name The name of the shared memory segment.
      * @param capacity The maximum number of tasks that can be stored in the shared memory.
+     * @param mode The synchronization scheme used by the queue (default: QueueMode::LOCKING).
+     * @throws std::invalid_argument If the capacity is invalid (zero or exceeds THROW_VALUE).
+     */
+    PosixSharedMemory(const std::string&, size_t = COUNT_TASKS, QueueMode = QueueMode::LOCKING);
+
+    /**
+     * @brief Constructor for a file-backed PosixSharedMemory.
+     *
+     * The queue always uses QueueMode::LOCKING; the name is only used for the semaphore.
+     *
+     * @param name The name of the queue.
+     * @param path The file holding the queue.
+     * @param capacity The maximum number of tasks that can be stored in the queue.
+     * @param sync When the mapping is flushed to disk (default: SyncPolicy::PER_BATCH).
      * @throws std::invalid_argument If the capacity is invalid (zero or exceeds THROW_VALUE).
      */
-    PosixSharedMemory(const std::string&, size_t = 100);
+    PosixSharedMemory(const std::string&, const std::string&, size_t = COUNT_TASKS, 
+        SyncPolicy = SyncPolicy::PER_BATCH);
 
     /**
      * @brief Destructor for PosixSharedMemory.
@@ -48,32 +120,91 @@ public:
      */
     ~PosixSharedMemory() override;
 
+    static constexpr size_t SLOTS_PER_LINE = 2;
+
+    /**
+     * @struct Slot
+     * @brief A single queue cell.
+     *
+     * In QueueMode::LOCK_FREE the sequence number tells whether the cell is
+     * free for the producer of position `pos` (sequence == pos) or holds a task
+     * ready for the consumer of that position (sequence == pos + 1). It is not
+     * used in QueueMode::LOCKING.
+     *
+     * The task is stored in compact form with its description interned in the
+     * DescriptionTable of the segment, so a slot takes 32 bytes instead of 288 and
+     * SLOTS_PER_LINE slots share a cache line. slot_index() keeps consecutive
+     * positions on different lines, so a producer filling one slot does not
+     * invalidate the line a consumer is reading from the neighbouring slot.
+     */
+    struct alignas(CACHE_LINE / SLOTS_PER_LINE) Slot 
+    {
+        std::atomic<uint32_t> sequence_;
+        CompactTask task_;
+    };
+
      /**
      * @struct SharedMemoryLayout
-     * @brief Defines the layout of the shared memory segment.
+     * @brief Defines the header of the shared memory segment.
      * 
-     * This structure represents the data layout of the shared memory segment. It includes
-     * atomic variables for synchronization and an array of tasks.
+     * This structure represents the header of the shared memory segment. It includes
+     * the queue geometry and atomic variables for synchronization. The slot region of
+     * `capacity_` Slot entries follows the header directly and is followed by the
+     * DescriptionTable, so the segment size is `segment_size(capacity_)`.
+     *
+     * Fields are grouped by writer and every group starts on its own cache line:
+     * the read-mostly geometry, the producer-owned rear_, the consumer-owned front_,
+     * the lock-protected count_, the rarely written futex events and the seqlock-protected
+     * statistics page. Every atomic is naturally aligned.
+     *
+     * In QueueMode::LOCK_FREE, front_ and rear_ are monotonically increasing positions
+     * and the futex events not_empty_/not_full_ wake blocked consumers/producers.
+     * doorbell_armed_ is set by a consumer that is about to wait on the doorbell.
      */
-    #pragma pack(push, 1)
     struct SharedMemoryLayout 
     {
-        std::atomic<size_t> front_;
-        std::atomic<size_t> rear_;
-        std::atomic<size_t> count_;
+        alignas(CACHE_LINE) uint64_t magic_;
+        size_t capacity_;
+        size_t mask_;
+        QueueMode mode_;
         std::atomic<bool> scheduler_running_;
-        SharedTask tasks_[COUNT_TASKS];
 
+        alignas(CACHE_LINE) std::atomic<size_t> rear_;
         std::atomic<size_t> total_enqueued_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> front_;
         std::atomic<size_t> total_dequeued_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> count_;
+
+        alignas(CACHE_LINE) FutexEvent not_empty_;
+        FutexEvent not_full_;
+        std::atomic<uint32_t> doorbell_armed_;
+
+        StatisticsPage statistics_;
     };
-    #pragma pack(pop)
+
+    static_assert(sizeof(Slot) * SLOTS_PER_LINE == CACHE_LINE && sizeof(SharedMemoryLayout) % CACHE_LINE == 0,
+                  "the slot region must start on a cache line boundary and pack whole slots into lines");
+
+    /**
+     * @brief Computes the size of a segment holding the given number of slots.
+     *
+     * @param capacity The number of slots.
+     * @return The size in bytes of the header, the slot region and the description table.
+     */
+    [[nodiscard]] static constexpr size_t segment_size(size_t capacity) noexcept
+    {
+        return sizeof(SharedMemoryLayout) + capacity * sizeof(Slot) + 
+            DescriptionTable::footprint(DescriptionTable::default_bytes(capacity));
+    }
 
     /**
      * @brief Creates a new shared memory segment.
      *
      * Allocates and initializes the shared memory segment and associated
-     * semaphores.
+     * semaphores. A file-backed queue whose file already holds a queue of the same
+     * capacity recovers its committed tasks instead of starting empty.
      * @throws std::runtime_error If shared memory or semaphore creation fails.
      */
     void create() override;
@@ -97,13 +228,15 @@ public:
      * @brief Destroys the shared memory segment.
      *
      * Releases all resources associated with the shared memory segment and semaphores.
+     * The file of a file-backed queue is kept.
      */
     void destroy() override;
 
     /**
      * @brief Enqueues a task into the shared memory.
      *
-     * Adds a task to the shared memory queue in a thread-safe manner.
+     * Adds a task to the shared memory queue in a thread-safe manner, blocking
+     * while the queue is full.
      *
      * @param task The task to be enqueued.
      * @throws std::runtime_error If semaphore operations fail.
@@ -114,13 +247,68 @@ public:
      * @brief Dequeues a task from the shared memory.
      *
      * Removes and returns a task from the shared memory queue in a thread-safe
-     * manner.
+     * manner, blocking while the queue is empty.
      *
      * @return The dequeued task.
-     * @throws std::runtime_error If the queue is empty or semaphore operations fail.
+     * @throws std::runtime_error If semaphore operations fail.
      */
     SharedTask dequeue() override;
 
+    /**
+     * @brief Enqueues a batch of tasks into the shared memory.
+     *
+     * Stores as many tasks as fit with one lock acquisition (or one slot claim in
+     * QueueMode::LOCK_FREE) and wakes consumers once per stored chunk. Blocks while
+     * the queue is full until the whole batch is stored.
+     *
+     * @param tasks The tasks to be enqueued, in order.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void enqueue_bulk(std::span<const SharedTask> tasks) override;
+
+    /**
+     * @brief Dequeues a batch of tasks from the shared memory.
+     *
+     * Blocks until at least one task is available, then removes up to `max`
+     * tasks with one lock acquisition (or one slot claim in QueueMode::LOCK_FREE).
+     *
+     * @param tasks Receives the dequeued tasks, in order.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Dequeues a batch of tasks without blocking.
+     *
+     * @param tasks Receives the dequeued tasks, in order.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`, 0 if the queue is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t try_dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Dequeues a task without blocking.
+     *
+     * @return The dequeued task, or std::nullopt if the queue is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> try_dequeue() override;
+
+    /**
+     * @brief Dequeues a task, blocking at most for the given timeout.
+     *
+     * The caller sleeps on the not_empty_ futex event of the segment, so an
+     * enqueue from any process wakes it immediately.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return The dequeued task, or std::nullopt if the timeout expired.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> dequeue_for(std::chrono::milliseconds timeout) override;
+
     /**
      * @brief Gets the current number of tasks in the shared memory.
      *
@@ -128,7 +316,12 @@ public:
      */
     [[nodiscard]] inline size_t size() const override 
     { 
-       return data_->count_.load(std::memory_order_relaxed);
+        if (mode_ == QueueMode::LOCKING)
+            return data_->count_.load(std::memory_order_relaxed);
+
+        size_t front = data_->front_.load(std::memory_order_relaxed);
+        size_t rear = data_->rear_.load(std::memory_order_relaxed);
+        return std::min(rear - front, capacity_);
     }
 
     /**
@@ -139,7 +332,7 @@ public:
      * @param running The new status of the scheduler (true if running, false
      * otherwise).
      */
-    inline void set_scheduler_running(bool running) 
+    inline void set_scheduler_running(bool running) override 
     {
         if (data_) 
             data_->scheduler_running_.store(running, std::memory_order_release);
@@ -150,7 +343,7 @@ public:
      *
      * @return True if the scheduler is running, false otherwise.
      */
-    [[nodiscard]] inline bool is_scheduler_running() const 
+    [[nodiscard]] inline bool is_scheduler_running() const override 
     {
         return data_ && data_->scheduler_running_.load(std::memory_order_acquire);
     }
@@ -186,10 +379,94 @@ public:
         return capacity_; 
     }
 
-    void print();
+    /**
+     * @brief Gets the synchronization scheme of the queue.
+     *
+     * After attach() this reflects the mode the segment was created with.
+     *
+     * @return The queue mode.
+     */
+    [[nodiscard]] inline QueueMode mode() const noexcept 
+    { 
+        return mode_; 
+    }
+
+    /**
+     * @brief Checks whether the queue lives in a file.
+     *
+     * @return True if the queue was constructed with a file path.
+     */
+    [[nodiscard]] inline bool is_persistent() const noexcept 
+    { 
+        return !path_.empty(); 
+    }
+
+    /**
+     * @brief Checks whether the queue orders tasks by priority.
+     *
+     * @return Always false: the queue is FIFO in both modes.
+     */
+    [[nodiscard]] inline bool is_priority_ordered() const noexcept override 
+    { 
+        return false; 
+    }
+
+    /**
+     * @brief Sets the doorbell rung by enqueues of this process.
+     *
+     * Every process that enqueues should set the doorbell received from the segment
+     * creator, otherwise its tasks do not wake consumers that wait on the doorbell.
+     *
+     * @param doorbell The doorbell, or nullptr to stop ringing.
+     */
+    inline void set_doorbell(std::shared_ptr<Doorbell> doorbell) noexcept
+    {
+        doorbell_ = std::move(doorbell);
+    }
+
+    /**
+     * @brief Asks producers to ring the doorbell on the next enqueue.
+     *
+     * A consumer calls this after draining the doorbell and the queue and before it
+     * waits for the doorbell descriptor. Producers ring only when a consumer armed the
+     * doorbell, so enqueues do not pay for a write(2) while consumers are busy.
+     *
+     * @return True if the queue is still empty and the caller may wait; false if a
+     * task arrived meanwhile and the caller should dequeue first.
+     * @throws std::runtime_error If the shared memory is not attached.
+     */
+    bool arm_doorbell();
+
+    /**
+     * @brief Takes a snapshot of the statistics page of the segment.
+     *
+     * Reads the page through its seqlock and never takes the queue lock, so it is
+     * safe to call from a monitoring process that merely attached to the segment.
+     *
+     * @return Totals, the queue-depth high-water mark, producer blocking time,
+     * consumer idle time and per-priority counts since the segment was created.
+     * @throws std::runtime_error If the shared memory is not attached.
+     */
+    [[nodiscard]] QueueStatistics statistics() const;
+
+    /**
+     * @brief Calls a visitor with every queued task in FIFO order.
+     *
+     * In QueueMode::LOCKING the visitor sees the slots in place under the semaphore
+     * mutex. In QueueMode::LOCK_FREE nothing is locked: every slot is copied out and
+     * checked against its sequence number, and the visit stops at the first slot
+     * that is not ready or was consumed meanwhile.
+     *
+     * @param visitor Called once per queued task.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void for_each_slot(const std::function<void(const TaskView&)>&) override;
 
 private:
 
+    static constexpr size_t STAGED_TASKS = 64;
+    static constexpr size_t LINE_SHIFT = std::countr_zero(SLOTS_PER_LINE);
+
     /**
      * @brief Cleans up resources associated with the shared memory.
      * 
@@ -206,14 +483,171 @@ private:
      */
     void validate() const;
 
+    /**
+     * @brief Maps the opened shared memory object into the address space.
+     *
+     * Maps `segment_size(capacity_)` bytes and points slots_ past the header and
+     * descriptions_ past the slot region.
+     *
+     * @throws std::runtime_error If mmap fails.
+     */
+    void map();
+
+    /**
+     * @brief Initializes the header, the slots and the description table of a new segment.
+     */
+    void initialize();
+
+    /**
+     * @brief Opens the backing file and checks whether it holds a queue to recover.
+     *
+     * @return True if the file holds a valid queue of the same capacity.
+     * @throws std::runtime_error If the file cannot be opened or resized.
+     */
+    bool open_file();
+
+    /**
+     * @brief Rebuilds the volatile state of a recovered queue from its commit records.
+     *
+     * @return False if the commit records are inconsistent.
+     */
+    bool recover();
+
+    /**
+     * @brief Flushes the mapping according to the sync policy.
+     *
+     * With SyncPolicy::PER_BATCH a flush before the commit record covers the whole
+     * segment and is only used for a new segment; enqueues use sync_batch() instead.
+     *
+     * @param before_commit True when called between writing the data and the commit record.
+     * @return False if msync failed; errno tells why.
+     */
+    bool sync(bool before_commit) noexcept;
+
+    /**
+     * @brief Flushes the slots of a batch and the description records they reference (SyncPolicy::PER_BATCH).
+     *
+     * @param first The wrapped index of the first slot of the batch.
+     * @param count The number of slots written.
+     * @return False if msync failed; errno tells why.
+     */
+    bool sync_batch(size_t first, size_t count) noexcept;
+
+    /**
+     * @brief Rings the doorbell if a consumer armed it.
+     */
+    inline void ring_doorbell() noexcept
+    {
+        if (!doorbell_)
+            return;
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (data_->doorbell_armed_.load(std::memory_order_relaxed) != 0 &&
+            data_->doorbell_armed_.exchange(0, std::memory_order_relaxed) != 0)
+            doorbell_->ring();
+    }
+
+    /**
+     * @brief Wraps a queue position into the range [0, capacity_).
+     *
+     * @param position The position (or unwrapped index) in the queue.
+     * @return The wrapped index, as kept in front_ and rear_ in QueueMode::LOCKING.
+     */
+    [[nodiscard]] inline size_t wrap(size_t position) const noexcept
+    {
+        return mask_ ? (position & mask_) : (position % capacity_);
+    }
+
+    /**
+     * @brief Converts a queue position into a slot index.
+     *
+     * For a power-of-two capacity the wrapped index is rotated left within its bits,
+     * so consecutive positions land in different halves of the slot region and never
+     * share a cache line; positions share one only if they are capacity / 2 apart.
+     * Other capacities use the wrapped index directly.
+     *
+     * @param position The position (or unwrapped index) in the queue.
+     * @return The index of the slot in the slot region.
+     */
+    [[nodiscard]] inline size_t slot_index(size_t position) const noexcept
+    {
+        if (!mask_)
+            return position % capacity_;
+        size_t index = position & mask_;
+        return ((index << LINE_SHIFT) | (index >> rotation_)) & mask_;
+    }
+
+    /**
+     * @brief Computes the right shift that completes the rotation of slot_index().
+     */
+    [[nodiscard]] static constexpr size_t rotation_of(size_t mask) noexcept
+    {
+        return mask ? static_cast<size_t>(std::popcount(mask)) - LINE_SHIFT : 0;
+    }
+
+    /**
+     * @brief Truncates a queue position to the width of a slot sequence number.
+     *
+     * Sequence numbers are compared by their signed 32-bit difference, which is exact
+     * as long as fewer than 2^31 positions separate a producer from a consumer; the
+     * capacity is bounded by THROW_VALUE.
+     */
+    [[nodiscard]] static constexpr uint32_t sequence_of(size_t position) noexcept
+    {
+        return static_cast<uint32_t>(position);
+    }
+
+    /**
+     * @brief Stores a prefix of the batch under the semaphore mutex (QueueMode::LOCKING).
+     *
+     * @param tasks The tasks to be enqueued.
+     * @return The number of tasks stored, 0 if the queue is full.
+     */
+    size_t try_enqueue_locked(std::span<const SharedTask>);
+
+    /**
+     * @brief Removes up to tasks.size() tasks under the semaphore mutex (QueueMode::LOCKING).
+     *
+     * @param tasks Receives the dequeued tasks.
+     * @return The number of tasks retrieved, 0 if the queue is empty.
+     */
+    size_t try_dequeue_locked(std::span<SharedTask>);
+
+    /**
+     * @brief Claims the longest run of free slots for the batch and fills it (QueueMode::LOCK_FREE).
+     *
+     * Up to STAGED_TASKS descriptions are interned before the slots are claimed, because
+     * a claimed slot must be filled; references of tasks that did not get a slot are
+     * dropped again.
+     *
+     * @param tasks The tasks to be enqueued.
+     * @return The number of tasks stored, 0 if the queue is full.
+     */
+    size_t try_enqueue_lock_free(std::span<const SharedTask>);
+
+    /**
+     * @brief Claims the longest run of ready slots and copies them out (QueueMode::LOCK_FREE).
+     *
+     * @param tasks Receives the dequeued tasks.
+     * @return The number of tasks retrieved, 0 if the queue is empty.
+     */
+    size_t try_dequeue_lock_free(std::span<SharedTask>);
+
     std::string name_;
+    std::string path_;
+    SyncPolicy sync_;
+    std::chrono::steady_clock::time_point last_sync_;
     size_t capacity_;
+    size_t mask_;
+    size_t rotation_;
+    QueueMode mode_;
     int fd_;
     SharedMemoryLayout* data_;
+    Slot* slots_;
+    DescriptionTable* descriptions_;
     
-    sem_t* enqueue_sem_;
-    sem_t* dequeue_sem_;
     sem_t* mutex_sem_;
+    std::shared_ptr<Doorbell> doorbell_;
 
     std::shared_ptr<Logger> logger_error_;
     std::shared_ptr<Logger> logger_state_;
@@ -6,14 +6,37 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
-PosixSharedMemory::PosixSharedMemory(const std::string& name, size_t capacity)
-    : name_(name), capacity_(capacity), fd_(-1), data_(nullptr),
-    enqueue_sem_(SEM_FAILED), dequeue_sem_(SEM_FAILED), mutex_sem_(SEM_FAILED)
+namespace
+{
+    /**
+     * @brief Flushes the pages of a mapping that hold the bytes [begin, end).
+     *
+     * @return False if msync failed; errno tells why.
+     */
+    bool flush(const char* begin, const char* end) noexcept
+    {
+        static const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t first = reinterpret_cast<uintptr_t>(begin) & ~(page - 1);
+        return msync(reinterpret_cast<void*>(first), reinterpret_cast<uintptr_t>(end) - first, MS_SYNC) != -1;
+    }
+}
+
+PosixSharedMemory::PosixSharedMemory(const std::string& name, size_t capacity, QueueMode mode)
+    : name_(name), sync_(SyncPolicy::NONE), capacity_(capacity), mask_((capacity & (capacity - 1)) == 0 ? capacity - 1 : 0),
+    rotation_(rotation_of(mask_)), mode_(mode), fd_(-1), data_(nullptr), slots_(nullptr), descriptions_(nullptr),
+    mutex_sem_(SEM_FAILED)
 {
     if (capacity == 0 || capacity > THROW_VALUE)
         throw std::invalid_argument("Invalid value of capacity");
-    logger_error_ = std::make_shared<ErrorLogger>(LOGS_DIR, ERROR_DIR);
-    logger_state_ = std::make_shared<FileLogger>(LOGS_DIR, STATE_DIR);
+    logger_error_ = std::make_shared<SharedLogger>(LOGS_DIR, ERROR_DIR, OverflowPolicy::COUNT, LogFormat::ERROR);
+    logger_state_ = std::make_shared<SharedLogger>(LOGS_DIR, STATE_DIR, OverflowPolicy::COUNT, STATE_LOG_FORMAT);
+}
+
+PosixSharedMemory::PosixSharedMemory(const std::string& name, const std::string& path, size_t capacity, 
+    SyncPolicy sync) : PosixSharedMemory(name, capacity, QueueMode::LOCKING)
+{
+    path_ = path;
+    sync_ = sync;
 }
 
 PosixSharedMemory::~PosixSharedMemory() 
@@ -23,64 +46,226 @@ PosixSharedMemory::~PosixSharedMemory()
 
 void PosixSharedMemory::create() 
 {
-    size_t total_size = sizeof(SharedMemoryLayout) + (capacity_ - 1) * sizeof(SharedTask);
+    size_t total_size = segment_size(capacity_);
 
-    sem_unlink(std::string("/" + name_ + "_enq").c_str());
-    sem_unlink(std::string("/" + name_ + "_deq").c_str());
     sem_unlink(std::string("/" + name_ + "_mut").c_str());
 
-    shm_unlink(name_.c_str());
-    fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
-    if (fd_ == -1) 
-        throw std::runtime_error("Failed to create shared memory: " + std::string(strerror(errno)));
+    bool recovered = false;
+    if (is_persistent())
+        recovered = open_file();
+    else 
+    {
+        shm_unlink(name_.c_str());
+        fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+        if (fd_ == -1) 
+            throw std::runtime_error("Failed to create shared memory: " + std::string(strerror(errno)));
 
-    if (ftruncate(fd_, total_size) == -1) 
+        if (ftruncate(fd_, total_size) == -1) 
+        {
+            close(fd_);
+            throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+        }
+    }
+
+    map();
+
+    if (recovered && recover()) 
+        LOG_INFO(logger_state_, "Recovered " + std::to_string(size()) + " tasks from " + path_);
+    else 
     {
-        close(fd_);
-        throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+        data_->magic_ = 0;
+        initialize();
+        if (is_persistent()) 
+        {
+            if (!sync(true))
+                throw std::runtime_error("msync failed: " + std::string(strerror(errno)));
+            data_->magic_ = QUEUE_MAGIC;
+            if (!sync(false))
+                throw std::runtime_error("msync failed: " + std::string(strerror(errno)));
+        }
+        else 
+            data_->magic_ = QUEUE_MAGIC;
     }
 
-    attach();
+    if (mode_ == QueueMode::LOCKING) 
+    {
+        mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), O_CREAT | O_EXCL, 0666, 1);
 
+        if (mutex_sem_ == SEM_FAILED)
+            throw std::runtime_error("Failed to create semaphores");
+    }
+}
+
+void PosixSharedMemory::initialize() 
+{
+    data_->capacity_ = capacity_;
+    data_->mask_ = mask_;
     data_->front_.store(0);
     data_->rear_.store(0);
     data_->count_.store(0);
     data_->scheduler_running_.store(false);
+    data_->mode_ = mode_;
+    data_->not_empty_.reset();
+    data_->not_full_.reset();
+    data_->doorbell_armed_.store(0);
     data_->total_enqueued_.store(0);
     data_->total_dequeued_.store(0);
+    data_->statistics_.reset();
+    descriptions_->reset(DescriptionTable::default_bytes(capacity_));
+
+    if (mode_ == QueueMode::LOCK_FREE)
+        for (size_t i = 0; i < capacity_; ++i)
+            slots_[slot_index(i)].sequence_.store(sequence_of(i), std::memory_order_relaxed);
+}
+
+bool PosixSharedMemory::open_file() 
+{
+    fd_ = open(path_.c_str(), O_CREAT | O_RDWR, 0666);
+    if (fd_ == -1) 
+        throw std::runtime_error("Failed to open queue file: " + std::string(strerror(errno)));
+
+    struct stat status;
+    if (fstat(fd_, &status) == 0 && static_cast<size_t>(status.st_size) == segment_size(capacity_))
+        return true;
+
+    if (ftruncate(fd_, 0) == -1 || ftruncate(fd_, segment_size(capacity_)) == -1) 
+    {
+        close(fd_);
+        fd_ = -1;
+        throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+    }
+    return false;
+}
+
+bool PosixSharedMemory::recover() 
+{
+    if (data_->magic_ != QUEUE_MAGIC || data_->capacity_ != capacity_ || data_->mode_ != QueueMode::LOCKING)
+        return false;
+
+    size_t head = data_->total_dequeued_.load(std::memory_order_relaxed);
+    size_t tail = data_->total_enqueued_.load(std::memory_order_relaxed);
+    if (tail < head || tail - head > capacity_)
+        return false;
+
+    bool valid = descriptions_->recover([this, head, tail](auto&& visit) 
+    {
+        for (size_t position = head; position != tail; ++position)
+            visit(slots_[slot_index(position)].task_);
+    });
+    if (!valid)
+        return false;
+
+    data_->mask_ = mask_;
+    data_->front_.store(wrap(head));
+    data_->rear_.store(wrap(tail));
+    data_->count_.store(tail - head);
+    data_->scheduler_running_.store(false);
+    data_->not_empty_.reset();
+    data_->not_full_.reset();
+    data_->doorbell_armed_.store(0);
+    data_->statistics_.recover();
+    return true;
+}
+
+bool PosixSharedMemory::sync(bool before_commit) noexcept
+{
+    if (sync_ == SyncPolicy::NONE || !data_)
+        return true;
+
+    int result = 0;
+    if (sync_ == SyncPolicy::PER_BATCH) 
+        result = before_commit ? msync(data_, segment_size(capacity_), MS_SYNC)
+                               : msync(data_, sizeof(SharedMemoryLayout), MS_SYNC);
+    else if (!before_commit) 
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_sync_ < std::chrono::milliseconds(SYNC_PERIOD_MS))
+            return true;
+        last_sync_ = now;
+        result = msync(data_, segment_size(capacity_), MS_SYNC);
+    }
 
-    enqueue_sem_ = sem_open(std::string("/" + name_ + "_enq").c_str(), O_CREAT | O_EXCL, 0666, capacity_);
-    dequeue_sem_ = sem_open(std::string("/" + name_ + "_deq").c_str(), O_CREAT | O_EXCL, 0666, 0);
-    mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), O_CREAT | O_EXCL, 0666, 1);
+    return result != -1;
+}
+
+bool PosixSharedMemory::sync_batch(size_t first, size_t count) noexcept
+{
+    if (sync_ != SyncPolicy::PER_BATCH || count == 0)
+        return true;
+
+    const char* slots_begin = reinterpret_cast<const char*>(slots_ + capacity_);
+    const char* slots_end = reinterpret_cast<const char*>(slots_);
+    const char* records_begin = slots_begin;
+    const char* records_end = slots_end;
+    for (size_t i = 0; i < count; ++i) 
+    {
+        const Slot& slot = slots_[slot_index(first + i)];
+        slots_begin = std::min(slots_begin, reinterpret_cast<const char*>(&slot));
+        slots_end = std::max(slots_end, reinterpret_cast<const char*>(&slot + 1));
+
+        auto record = descriptions_->record_bytes(slot.task_.description_);
+        records_begin = std::min(records_begin, record.data());
+        records_end = std::max(records_end, record.data() + record.size());
+    }
 
-    if (enqueue_sem_ == SEM_FAILED || dequeue_sem_ == SEM_FAILED || mutex_sem_ == SEM_FAILED)
-        throw std::runtime_error("Failed to create semaphores");
+    return flush(slots_begin, slots_end) && flush(records_begin, records_end);
 }
 
 void PosixSharedMemory::attach() 
 {
     if (fd_ == -1) 
     {
-        fd_ = shm_open(name_.c_str(), O_RDWR, 0666);
+        fd_ = is_persistent() ? open(path_.c_str(), O_RDWR) : shm_open(name_.c_str(), O_RDWR, 0666);
         if (fd_ == -1) 
             throw std::runtime_error("shm_open failed: " + std::string(strerror(errno)));
     }
 
-    size_t total_size = sizeof(SharedMemoryLayout) + (capacity_ - 1) * sizeof(SharedTask);
+    void* address = mmap(nullptr, sizeof(SharedMemoryLayout), PROT_READ, MAP_SHARED, fd_, 0);
+    if (address == MAP_FAILED) 
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    const auto* header = static_cast<const SharedMemoryLayout*>(address);
+    capacity_ = header->capacity_;
+    mask_ = header->mask_;
+    rotation_ = rotation_of(mask_);
+    mode_ = header->mode_;
+    munmap(address, sizeof(SharedMemoryLayout));
+
+    if (capacity_ == 0 || capacity_ > THROW_VALUE)
+        throw std::runtime_error("Shared memory header holds an invalid capacity");
 
-    data_ = static_cast<SharedMemoryLayout*>(mmap(nullptr, total_size,
-                    PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0));
+    map();
 
-    if (data_ == MAP_FAILED) 
+    if (mode_ == QueueMode::LOCKING && mutex_sem_ == SEM_FAILED) 
+    {
+        mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), 0);
+        if (mutex_sem_ == SEM_FAILED)
+            throw std::runtime_error("Failed to open semaphores: " + std::string(strerror(errno)));
+    }
+}
+
+void PosixSharedMemory::map() 
+{
+    void* address = mmap(nullptr, segment_size(capacity_), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+
+    if (address == MAP_FAILED) 
         throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    data_ = static_cast<SharedMemoryLayout*>(address);
+    slots_ = reinterpret_cast<Slot*>(data_ + 1);
+    descriptions_ = reinterpret_cast<DescriptionTable*>(slots_ + capacity_);
 }
 
 void PosixSharedMemory::detach() 
 {
     if (data_) 
     {
-        munmap(data_, sizeof(SharedMemoryLayout) + (capacity_ - 1) * sizeof(SharedTask));
+        if (sync_ != SyncPolicy::NONE)
+            msync(data_, segment_size(capacity_), MS_SYNC);
+        munmap(data_, segment_size(capacity_));
         data_ = nullptr;
+        slots_ = nullptr;
+        descriptions_ = nullptr;
     }
 }
 
@@ -90,116 +275,349 @@ void PosixSharedMemory::destroy()
     if (fd_ != -1) 
     {
         close(fd_);
-        shm_unlink(name_.c_str());
+        if (!is_persistent())
+            shm_unlink(name_.c_str());
         fd_ = -1;
     }
 
-    if (enqueue_sem_ != SEM_FAILED) 
-        sem_close(enqueue_sem_);
-    if (dequeue_sem_ != SEM_FAILED) 
-        sem_close(dequeue_sem_);
     if (mutex_sem_ != SEM_FAILED) 
         sem_close(mutex_sem_);
+    mutex_sem_ = SEM_FAILED;
 
-    sem_unlink(std::string("/" + name_ + "_enq").c_str());
-    sem_unlink(std::string("/" + name_ + "_deq").c_str());
     sem_unlink(std::string("/" + name_ + "_mut").c_str());
 }
 
 void PosixSharedMemory::enqueue(const SharedTask& task) 
 {
-    if (sem_wait(enqueue_sem_) == -1) 
-        throw std::runtime_error("Enqueue semaphore wait failed");
-    if (sem_wait(mutex_sem_) == -1) 
+    enqueue_bulk(std::span<const SharedTask>(&task, 1));
+}
+
+SharedTask PosixSharedMemory::dequeue() 
+{
+    SharedTask task;
+    dequeue_bulk(std::span<SharedTask>(&task, 1), 1);
+    return task;
+}
+
+void PosixSharedMemory::enqueue_bulk(std::span<const SharedTask> tasks) 
+{
+    size_t done = 0;
+
+    while (done < tasks.size()) 
     {
-        sem_post(enqueue_sem_);
-        throw std::runtime_error("Mutex semaphore wait failed");
+        size_t stored = mode_ == QueueMode::LOCK_FREE ? try_enqueue_lock_free(tasks.subspan(done))
+                                                      : try_enqueue_locked(tasks.subspan(done));
+        if (stored == 0) 
+        {
+            auto started = std::chrono::steady_clock::now();
+            data_->not_full_.wait([this, &tasks, done] 
+            { 
+                return size() < capacity_ && descriptions_->available(tasks[done].description_); 
+            });
+            data_->statistics_.record_producer_blocked(std::chrono::steady_clock::now() - started);
+            continue;
+        }
+
+        done += stored;
+        data_->not_empty_.notify(stored);
+        ring_doorbell();
     }
+}
 
-    size_t rear = data_->rear_.load(std::memory_order_relaxed);
-    data_->tasks_[rear] = task;
-    data_->rear_.store((rear + 1) % capacity_, std::memory_order_relaxed);
-    data_->count_.fetch_add(1, std::memory_order_relaxed);
-    data_->total_enqueued_.fetch_add(1, std::memory_order_relaxed);
+size_t PosixSharedMemory::dequeue_bulk(std::span<SharedTask> tasks, size_t max) 
+{
+    if (tasks.empty() || max == 0)
+        return 0;
 
-    logger_state_->log("Enqueued task with id: " + std::to_string(task.id_));
+    while (true) 
+    {
+        if (size_t taken = try_dequeue_bulk(tasks, max))
+            return taken;
 
-    sem_post(mutex_sem_);
-    sem_post(dequeue_sem_);
+        auto started = std::chrono::steady_clock::now();
+        data_->not_empty_.wait([this] { return size() > 0; });
+        data_->statistics_.record_consumer_idle(std::chrono::steady_clock::now() - started);
+    }
+}
+
+size_t PosixSharedMemory::try_dequeue_bulk(std::span<SharedTask> tasks, size_t max) 
+{
+    tasks = tasks.first(std::min(tasks.size(), max));
+    if (tasks.empty())
+        return 0;
+
+    size_t taken = mode_ == QueueMode::LOCK_FREE ? try_dequeue_lock_free(tasks)
+                                                 : try_dequeue_locked(tasks);
+    if (taken != 0)
+        data_->not_full_.notify(taken);
+    return taken;
 }
 
-void PosixSharedMemory::print() 
+std::optional<SharedTask> PosixSharedMemory::try_dequeue() 
 {
+    SharedTask task;
+    if (try_dequeue_bulk(std::span<SharedTask>(&task, 1), 1) == 0)
+        return std::nullopt;
+    return task;
+}
+
+std::optional<SharedTask> PosixSharedMemory::dequeue_for(std::chrono::milliseconds timeout) 
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true) 
+    {
+        if (auto task = try_dequeue())
+            return task;
+        auto started = std::chrono::steady_clock::now();
+        if (started >= deadline)
+            return std::nullopt;
+
+        data_->not_empty_.wait([this] { return size() > 0; }, deadline);
+        data_->statistics_.record_consumer_idle(std::chrono::steady_clock::now() - started);
+    }
+}
+
+bool PosixSharedMemory::arm_doorbell() 
+{
+    validate();
+
+    data_->doorbell_armed_.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return empty();
+}
+
+QueueStatistics PosixSharedMemory::statistics() const 
+{
+    validate();
+    return data_->statistics_.snapshot();
+}
+
+void PosixSharedMemory::for_each_slot(const std::function<void(const TaskView&)>& visitor) 
+{
+    validate();
+
+    if (mode_ == QueueMode::LOCK_FREE) 
+    {
+        size_t rear = data_->rear_.load(std::memory_order_acquire);
+        for (size_t position = data_->front_.load(std::memory_order_acquire); position != rear; ++position) 
+        {
+            Slot& slot = slots_[slot_index(position)];
+            if (slot.sequence_.load(std::memory_order_acquire) != sequence_of(position + 1))
+                break;
+
+            SharedTask task;
+            descriptions_->peek(slot.task_, task);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence_.load(std::memory_order_relaxed) != sequence_of(position + 1))
+                break;
+            visitor(view_of(task));
+        }
+        return;
+    }
+
     if (sem_wait(mutex_sem_) == -1) 
-        throw std::runtime_error("Mutex semaphore wait failed during print");
+        throw std::runtime_error("Mutex semaphore wait failed during visit");
 
     try 
     {
-        validate();
+        size_t index = data_->front_.load(std::memory_order_relaxed);
+        size_t count = data_->count_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i, index = wrap(index + 1)) 
+            visitor(descriptions_->view(slots_[slot_index(index)].task_));
+    } 
+    catch (const std::exception& e) 
+    {
+        LOG_ERROR(logger_error_, "Error during visit: " + std::string(e.what()));
+        sem_post(mutex_sem_);
+        throw;
+    }
+    
+    sem_post(mutex_sem_);
+}
 
-        size_t front = data_->front_.load(std::memory_order_relaxed);
-        size_t rear = data_->rear_.load(std::memory_order_relaxed);
+size_t PosixSharedMemory::try_enqueue_locked(std::span<const SharedTask> tasks) 
+{
+    if (data_->count_.load(std::memory_order_relaxed) >= capacity_)
+        return 0;
+
+    if (sem_wait(mutex_sem_) == -1) 
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t stored = 0;
+    try 
+    {
         size_t count = data_->count_.load(std::memory_order_relaxed);
+        size_t first = data_->rear_.load(std::memory_order_relaxed);
+        size_t rear = first;
 
-        if (count == 0) 
-            std::cout << "  [Empty]" << std::endl;
-        else 
+        for (stored = 0; stored < std::min(tasks.size(), capacity_ - count); ++stored) 
+        {
+            if (!descriptions_->store(tasks[stored], slots_[slot_index(rear)].task_))
+                break;
+            rear = wrap(rear + 1);
+        }
+
+        if (!sync_batch(first, stored)) 
         {
-            size_t index = front;
-            for (size_t i = 0; i < count; ++i) 
-            {
-                const SharedTask& task = data_->tasks_[index];
-                std::cout << "  Task ID: " << task.id_
-                          << ", Priority: " << task.priority_
-                          << ", Description: " << task.description_
-                          << ", Completed: " << (task.completed_ ? "Yes" : "No")
-                          << ", Remaining Time: " << task.remaining_time_ms_ << " ms"
-                          << std::endl;
-                index = (index + 1) % capacity_;
-            }
+            std::string error = strerror(errno);
+            for (size_t i = 0; i < stored; ++i) 
+                descriptions_->release(slots_[slot_index(first + i)].task_.description_);
+            throw std::runtime_error("msync failed before commit: " + error);
         }
+
+        data_->total_enqueued_.fetch_add(stored, std::memory_order_release);
+        data_->rear_.store(rear, std::memory_order_relaxed);
+        data_->count_.fetch_add(stored, std::memory_order_relaxed);
+        if (!sync(false))
+            LOG_ERROR(logger_error_, "msync failed after commit: " + std::string(strerror(errno)));
+        if (stored != 0)
+            data_->statistics_.record_enqueue(tasks.first(stored), count + stored);
+
+        if (stored == 1)
+            LOG_TRACE_EVENT(logger_state_, "Enqueued task with id: {}", tasks[0].id_);
+        else if (stored > 1)
+            LOG_TRACE_EVENT(logger_state_, "Enqueued {} tasks starting with id: {}", stored, tasks[0].id_);
     } 
     catch (const std::exception& e) 
     {
-        logger_error_->log("Error during print: " + std::string(e.what()));
+        LOG_ERROR(logger_error_, "Error during enqueue: " + std::string(e.what()));
         sem_post(mutex_sem_);
         throw;
     }
-    
+
     sem_post(mutex_sem_);
+    return stored;
 }
 
-SharedTask PosixSharedMemory::dequeue() 
+size_t PosixSharedMemory::try_dequeue_locked(std::span<SharedTask> tasks) 
 {
-    if (sem_wait(dequeue_sem_) == -1)
-        throw std::runtime_error("Dequeue semaphore wait failed");
+    if (data_->count_.load(std::memory_order_relaxed) == 0)
+        return 0;
 
     if (sem_wait(mutex_sem_) == -1) 
-    {
-        sem_post(dequeue_sem_);
         throw std::runtime_error("Mutex semaphore wait failed");
-    }
 
-    size_t front = data_->front_.load(std::memory_order_relaxed);
+    size_t taken = std::min(tasks.size(), data_->count_.load(std::memory_order_relaxed));
+    try 
+    {
+        size_t front = data_->front_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < taken; ++i) 
+        {
+            descriptions_->load(slots_[slot_index(front)].task_, tasks[i]);
+            front = wrap(front + 1);
+        }
 
-    if (data_->count_.load(std::memory_order_relaxed) == 0) 
+        data_->total_dequeued_.fetch_add(taken, std::memory_order_release);
+        data_->front_.store(front, std::memory_order_relaxed);
+        data_->count_.fetch_sub(taken, std::memory_order_relaxed);
+        if (!sync(false))
+            LOG_ERROR(logger_error_, "msync failed after commit: " + std::string(strerror(errno)));
+        data_->statistics_.record_dequeue(tasks.first(taken));
+
+        if (taken == 1)
+            LOG_TRACE_EVENT(logger_state_, "Dequeued task with id: {}", tasks[0].id_);
+        else if (taken > 1)
+            LOG_TRACE_EVENT(logger_state_, "Dequeued {} tasks starting with id: {}", taken, tasks[0].id_);
+    } 
+    catch (const std::exception& e) 
     {
+        LOG_ERROR(logger_error_, "Error during dequeue: " + std::string(e.what()));
         sem_post(mutex_sem_);
-        sem_post(dequeue_sem_);
-        throw std::runtime_error("Queue is empty");
+        throw;
     }
 
-    SharedTask task = data_->tasks_[front];
-    data_->front_.store((front + 1) % capacity_, std::memory_order_relaxed);
-    data_->count_.fetch_sub(1, std::memory_order_relaxed);
-    data_->total_dequeued_.fetch_add(1, std::memory_order_relaxed);
+    sem_post(mutex_sem_);
+    return taken;
+}
 
-    logger_state_->log("Dequeued task with id: " + std::to_string(task.id_));
+size_t PosixSharedMemory::try_enqueue_lock_free(std::span<const SharedTask> tasks) 
+{
+    CompactTask staged[STAGED_TASKS];
+    size_t count = 0;
+    for (; count < std::min(tasks.size(), STAGED_TASKS); ++count) 
+        if (!descriptions_->store(tasks[count], staged[count]))
+            break;
+    if (count == 0)
+        return 0;
+
+    size_t position = data_->rear_.load(std::memory_order_relaxed);
+    size_t claimed = 0;
+
+    while (true) 
+    {
+        int32_t diff = 0;
+        for (claimed = 0; claimed < count; ++claimed) 
+        {
+            uint32_t sequence = slots_[slot_index(position + claimed)].sequence_.load(std::memory_order_acquire);
+            diff = static_cast<int32_t>(sequence - sequence_of(position + claimed));
+            if (diff != 0)
+                break;
+        }
 
-    sem_post(mutex_sem_);
-    sem_post(enqueue_sem_);
+        if (claimed != 0) 
+        {
+            if (data_->rear_.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed))
+                break;
+        } 
+        else if (diff < 0) 
+            break;
+        else 
+            position = data_->rear_.load(std::memory_order_relaxed);
+    }
 
-    return task;
+    for (size_t i = claimed; i < count; ++i) 
+        descriptions_->release(staged[i].description_);
+
+    if (claimed != 0)
+        data_->statistics_.record_enqueue(tasks.first(claimed), 
+            position + claimed - data_->front_.load(std::memory_order_relaxed));
+
+    for (size_t i = 0; i < claimed; ++i) 
+    {
+        Slot& slot = slots_[slot_index(position + i)];
+        slot.task_ = staged[i];
+        slot.sequence_.store(sequence_of(position + i + 1), std::memory_order_release);
+    }
+    return claimed;
+}
+
+size_t PosixSharedMemory::try_dequeue_lock_free(std::span<SharedTask> tasks) 
+{
+    size_t position = data_->front_.load(std::memory_order_relaxed);
+    size_t claimed = 0;
+
+    while (true) 
+    {
+        int32_t diff = 0;
+        for (claimed = 0; claimed < tasks.size(); ++claimed) 
+        {
+            uint32_t sequence = slots_[slot_index(position + claimed)].sequence_.load(std::memory_order_acquire);
+            diff = static_cast<int32_t>(sequence - sequence_of(position + claimed + 1));
+            if (diff != 0)
+                break;
+        }
+
+        if (claimed != 0) 
+        {
+            if (data_->front_.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed))
+                break;
+        } 
+        else if (diff < 0) 
+            return 0;
+        else 
+            position = data_->front_.load(std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < claimed; ++i) 
+    {
+        Slot& slot = slots_[slot_index(position + i)];
+        descriptions_->load(slot.task_, tasks[i]);
+        slot.sequence_.store(sequence_of(position + i + capacity_), std::memory_order_release);
+    }
+
+    data_->statistics_.record_dequeue(tasks.first(claimed));
+    return claimed;
 }
 
 void PosixSharedMemory::cleanup() 
@@ -210,11 +628,11 @@ void PosixSharedMemory::cleanup()
     } 
     catch (const std::exception& e) 
     {
-        logger_error_->log("Failed to clean up shared memory: " + std::string(e.what()));
+        LOG_ERROR(logger_error_, "Failed to clean up shared memory: " + std::string(e.what()));
     }
     catch (...) 
     {
-        logger_error_->log("Unknown exception occurred during cleanup.");
+        LOG_ERROR(logger_error_, "Unknown exception occurred during cleanup.");
     }
 }
 
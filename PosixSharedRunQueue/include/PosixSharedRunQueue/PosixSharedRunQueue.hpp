@@ -0,0 +1,342 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+#include <SharedMemory/DescriptionTable.hpp>
+#include <Futex/Futex.hpp>
+#include <Logger/SharedLogChannel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <semaphore.h>
+#include <span>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @class PosixSharedRunQueue
+ * @brief Implements the SharedMemory interface as multi-level run queues in POSIX shared memory.
+ *
+ * Like the classic Linux O(1) scheduler, the segment holds one FIFO per priority
+ * level in [MIN_PRIORITY, MAX_PRIORITY] and a PRIORITY_LEVELS-bit occupancy bitmap.
+ * Level 0 holds priority MAX_PRIORITY, so the highest non-empty level is the lowest
+ * set bit and is found with a single find-first-set instruction. Enqueue links a
+ * node at the tail of its level and dequeue unlinks the head of the first non-empty
+ * level: both are O(1) regardless of how many tasks are queued. Priorities outside
+ * the range are clamped to it.
+ *
+ * All operations are serialized through a named semaphore mutex; blocked producers
+ * and consumers sleep on futex events in the segment.
+ */
+class PosixSharedRunQueue : public SharedMemory
+{
+public:
+
+    /**
+     * @brief Constructor for PosixSharedRunQueue.
+     *
+     * @param name The name of the shared memory segment.
+     * @param capacity The maximum number of tasks that can be stored in all levels together.
+     * @throws std::invalid_argument If the capacity is invalid (zero or exceeds THROW_VALUE).
+     */
+    PosixSharedRunQueue(const std::string&, size_t = COUNT_TASKS);
+
+    /**
+     * @brief Destructor for PosixSharedRunQueue.
+     *
+     * Cleans up resources associated with the shared memory segment.
+     */
+    ~PosixSharedRunQueue() override;
+
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    /**
+     * @struct Node
+     * @brief A task linked into a level FIFO or into the free list.
+     */
+    struct Node
+    {
+        uint32_t next_;
+        CompactTask task_;
+    };
+
+    /**
+     * @struct Level
+     * @brief Head and tail nodes of one priority level, NO_NODE when the level is empty.
+     */
+    struct Level
+    {
+        uint32_t head_;
+        uint32_t tail_;
+    };
+
+    /**
+     * @struct SharedRunQueueLayout
+     * @brief Defines the header of the shared memory segment.
+     *
+     * The header is followed by `capacity_` Node entries and the DescriptionTable.
+     * `bitmap_` has bit `i` set exactly when `levels_[i]` is not empty.
+     */
+    struct SharedRunQueueLayout
+    {
+        alignas(CACHE_LINE) size_t capacity_;
+        std::atomic<bool> scheduler_running_;
+
+        alignas(CACHE_LINE) std::atomic<size_t> count_;
+        uint64_t bitmap_;
+        uint32_t free_head_;
+        size_t total_enqueued_;
+        size_t total_dequeued_;
+
+        alignas(CACHE_LINE) Level levels_[PRIORITY_LEVELS];
+
+        alignas(CACHE_LINE) FutexEvent not_empty_;
+        FutexEvent not_full_;
+    };
+
+    static_assert(PRIORITY_LEVELS <= 64, "the occupancy bitmap must fit into one word");
+
+    /**
+     * @brief Computes the size of a segment holding the given number of tasks.
+     *
+     * @param capacity The number of nodes.
+     * @return The size in bytes of the header, the node region and the description table.
+     */
+    [[nodiscard]] static constexpr size_t segment_size(size_t capacity) noexcept
+    {
+        return sizeof(SharedRunQueueLayout) + capacity * sizeof(Node) +
+            DescriptionTable::footprint(DescriptionTable::default_bytes(capacity));
+    }
+
+    /**
+     * @brief Maps a task priority to its run queue level.
+     *
+     * @param priority The task priority, clamped to [MIN_PRIORITY, MAX_PRIORITY].
+     * @return The level index, 0 for the highest priority.
+     */
+    [[nodiscard]] static constexpr size_t level_of(int priority) noexcept
+    {
+        return static_cast<size_t>(MAX_PRIORITY - std::clamp(priority, MIN_PRIORITY, MAX_PRIORITY));
+    }
+
+    /**
+     * @brief Creates a new shared memory segment.
+     *
+     * @throws std::runtime_error If shared memory or semaphore creation fails.
+     */
+    void create() override;
+
+    /**
+     * @brief Attaches to an existing shared memory segment.
+     *
+     * Reads the capacity from the segment header and maps the segment.
+     * @throws std::runtime_error If attachment fails.
+     */
+    void attach() override;
+
+    /**
+     * @brief Detaches from the shared memory segment.
+     */
+    void detach() override;
+
+    /**
+     * @brief Destroys the shared memory segment.
+     *
+     * Releases all resources associated with the shared memory segment and semaphores.
+     */
+    void destroy() override;
+
+    /**
+     * @brief Appends a task to the FIFO of its priority level, blocking while the queue is full.
+     *
+     * @param task The task to be enqueued.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void enqueue(const SharedTask &task) override;
+
+    /**
+     * @brief Removes the oldest task of the highest non-empty level, blocking while the queue is empty.
+     *
+     * @return The dequeued task.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    SharedTask dequeue() override;
+
+    /**
+     * @brief Appends a batch of tasks with one lock acquisition per stored chunk.
+     *
+     * @param tasks The tasks to be enqueued.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void enqueue_bulk(std::span<const SharedTask> tasks) override;
+
+    /**
+     * @brief Removes up to `max` tasks in priority order, blocking until at least one is available.
+     *
+     * @param tasks Receives the dequeued tasks, highest priority first.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes up to `max` tasks in priority order without blocking.
+     *
+     * @param tasks Receives the dequeued tasks, highest priority first.
+     * @param max The maximum number of tasks to dequeue.
+     * @return The number of tasks written to `tasks`, 0 if the queue is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    size_t try_dequeue_bulk(std::span<SharedTask> tasks, size_t max) override;
+
+    /**
+     * @brief Removes the next task without blocking.
+     *
+     * @return The dequeued task, or std::nullopt if the queue is empty.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> try_dequeue() override;
+
+    /**
+     * @brief Removes the next task, blocking at most for the given timeout.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return The dequeued task, or std::nullopt if the timeout expired.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    std::optional<SharedTask> dequeue_for(std::chrono::milliseconds timeout) override;
+
+    /**
+     * @brief Gets the current number of tasks in all levels.
+     *
+     * @return The number of tasks currently stored in the queue.
+     */
+    [[nodiscard]] inline size_t size() const override
+    {
+        return data_->count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sets the scheduler running status.
+     *
+     * @param running The new status of the scheduler.
+     */
+    inline void set_scheduler_running(bool running) override
+    {
+        if (data_)
+            data_->scheduler_running_.store(running, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks if the scheduler is running.
+     *
+     * @return True if the scheduler is running, false otherwise.
+     */
+    [[nodiscard]] inline bool is_scheduler_running() const override
+    {
+        return data_ && data_->scheduler_running_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return True if there are no tasks in the queue, false otherwise.
+     */
+    [[nodiscard]] inline bool empty() const override
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Gets the name of the shared memory segment.
+     *
+     * @return The name of the shared memory segment.
+     */
+    [[nodiscard]] inline const std::string& name() const noexcept override
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Gets the capacity of the queue.
+     *
+     * @return The maximum number of tasks that can be stored in all levels together.
+     */
+    [[nodiscard]] inline size_t capacity() const noexcept override
+    {
+        return capacity_;
+    }
+
+    /**
+     * @brief Checks whether the queue orders tasks by priority.
+     *
+     * @return Always true.
+     */
+    [[nodiscard]] inline bool is_priority_ordered() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Calls a visitor with every queued task in place, in dequeue order.
+     *
+     * @param visitor Called once per queued task under the semaphore mutex.
+     * @throws std::runtime_error If semaphore operations fail.
+     */
+    void for_each_slot(const std::function<void(const TaskView&)>&) override;
+
+private:
+
+    /**
+     * @brief Cleans up resources associated with the shared memory.
+     */
+    void cleanup();
+
+    /**
+     * @brief Ensures that the shared memory is attached.
+     *
+     * @throws std::runtime_error If the shared memory is not attached.
+     */
+    void validate() const;
+
+    /**
+     * @brief Maps the opened shared memory object and points nodes_ and descriptions_ into it.
+     *
+     * @throws std::runtime_error If mmap fails.
+     */
+    void map();
+
+    /**
+     * @brief Appends a prefix of the batch under the semaphore mutex.
+     *
+     * @param tasks The tasks to be enqueued.
+     * @return The number of tasks stored, 0 if the queue is full.
+     */
+    size_t try_push(std::span<const SharedTask>);
+
+    /**
+     * @brief Pops up to tasks.size() tasks under the semaphore mutex.
+     *
+     * @param tasks Receives the dequeued tasks.
+     * @return The number of tasks retrieved, 0 if the queue is empty.
+     */
+    size_t try_pop(std::span<SharedTask>);
+
+    std::string name_;
+    size_t capacity_;
+    int fd_;
+    SharedRunQueueLayout* data_;
+    Node* nodes_;
+    DescriptionTable* descriptions_;
+
+    sem_t* mutex_sem_;
+
+    std::shared_ptr<Logger> logger_error_;
+    std::shared_ptr<Logger> logger_state_;
+};
\ No newline at end of file
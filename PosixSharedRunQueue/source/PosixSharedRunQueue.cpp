@@ -0,0 +1,343 @@
+#include "PosixSharedRunQueue/PosixSharedRunQueue.hpp"
+
+#include <vector>
+
+PosixSharedRunQueue::PosixSharedRunQueue(const std::string& name, size_t capacity)
+    : name_(name), capacity_(capacity), fd_(-1), data_(nullptr), nodes_(nullptr), descriptions_(nullptr), mutex_sem_(SEM_FAILED)
+{
+    if (capacity == 0 || capacity > THROW_VALUE)
+        throw std::invalid_argument("Invalid value of capacity");
+    logger_error_ = std::make_shared<SharedLogger>(LOGS_DIR, ERROR_DIR, OverflowPolicy::COUNT, LogFormat::ERROR);
+    logger_state_ = std::make_shared<SharedLogger>(LOGS_DIR, STATE_DIR, OverflowPolicy::COUNT, STATE_LOG_FORMAT);
+}
+
+PosixSharedRunQueue::~PosixSharedRunQueue()
+{
+    cleanup();
+}
+
+void PosixSharedRunQueue::create()
+{
+    sem_unlink(std::string("/" + name_ + "_mut").c_str());
+
+    shm_unlink(name_.c_str());
+    fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0666);
+    if (fd_ == -1)
+        throw std::runtime_error("Failed to create shared memory: " + std::string(strerror(errno)));
+
+    if (ftruncate(fd_, segment_size(capacity_)) == -1)
+    {
+        close(fd_);
+        throw std::runtime_error("Ftruncate failed: " + std::string(strerror(errno)));
+    }
+
+    map();
+
+    data_->capacity_ = capacity_;
+    data_->scheduler_running_.store(false);
+    data_->count_.store(0);
+    data_->bitmap_ = 0;
+    data_->total_enqueued_ = 0;
+    data_->total_dequeued_ = 0;
+    data_->not_empty_.reset();
+    data_->not_full_.reset();
+
+    for (auto& level : data_->levels_)
+        level = Level{NO_NODE, NO_NODE};
+
+    data_->free_head_ = 0;
+    for (size_t i = 0; i < capacity_; ++i)
+        nodes_[i].next_ = i + 1 < capacity_ ? static_cast<uint32_t>(i + 1) : NO_NODE;
+    descriptions_->reset(DescriptionTable::default_bytes(capacity_));
+
+    mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), O_CREAT | O_EXCL, 0666, 1);
+
+    if (mutex_sem_ == SEM_FAILED)
+        throw std::runtime_error("Failed to create semaphores");
+}
+
+void PosixSharedRunQueue::attach()
+{
+    if (fd_ == -1)
+    {
+        fd_ = shm_open(name_.c_str(), O_RDWR, 0666);
+        if (fd_ == -1)
+            throw std::runtime_error("shm_open failed: " + std::string(strerror(errno)));
+    }
+
+    void* address = mmap(nullptr, sizeof(SharedRunQueueLayout), PROT_READ, MAP_SHARED, fd_, 0);
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    capacity_ = static_cast<const SharedRunQueueLayout*>(address)->capacity_;
+    munmap(address, sizeof(SharedRunQueueLayout));
+
+    if (capacity_ == 0 || capacity_ > THROW_VALUE)
+        throw std::runtime_error("Shared memory header holds an invalid capacity");
+
+    map();
+
+    if (mutex_sem_ == SEM_FAILED)
+    {
+        mutex_sem_ = sem_open(std::string("/" + name_ + "_mut").c_str(), 0);
+        if (mutex_sem_ == SEM_FAILED)
+            throw std::runtime_error("Failed to open semaphores: " + std::string(strerror(errno)));
+    }
+}
+
+void PosixSharedRunQueue::map()
+{
+    void* address = mmap(nullptr, segment_size(capacity_), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+
+    if (address == MAP_FAILED)
+        throw std::runtime_error("mmap failed: " + std::string(strerror(errno)));
+
+    data_ = static_cast<SharedRunQueueLayout*>(address);
+    nodes_ = reinterpret_cast<Node*>(data_ + 1);
+    descriptions_ = reinterpret_cast<DescriptionTable*>(nodes_ + capacity_);
+}
+
+void PosixSharedRunQueue::detach()
+{
+    if (data_)
+    {
+        munmap(data_, segment_size(capacity_));
+        data_ = nullptr;
+        nodes_ = nullptr;
+        descriptions_ = nullptr;
+    }
+}
+
+void PosixSharedRunQueue::destroy()
+{
+    detach();
+    if (fd_ != -1)
+    {
+        close(fd_);
+        shm_unlink(name_.c_str());
+        fd_ = -1;
+    }
+
+    if (mutex_sem_ != SEM_FAILED)
+        sem_close(mutex_sem_);
+    mutex_sem_ = SEM_FAILED;
+
+    sem_unlink(std::string("/" + name_ + "_mut").c_str());
+}
+
+void PosixSharedRunQueue::enqueue(const SharedTask& task)
+{
+    enqueue_bulk(std::span<const SharedTask>(&task, 1));
+}
+
+SharedTask PosixSharedRunQueue::dequeue()
+{
+    SharedTask task;
+    dequeue_bulk(std::span<SharedTask>(&task, 1), 1);
+    return task;
+}
+
+void PosixSharedRunQueue::enqueue_bulk(std::span<const SharedTask> tasks)
+{
+    size_t done = 0;
+
+    while (done < tasks.size())
+    {
+        size_t stored = try_push(tasks.subspan(done));
+        if (stored == 0)
+        {
+            data_->not_full_.wait([this, &tasks, done] 
+            { 
+                return size() < capacity_ && descriptions_->available(tasks[done].description_); 
+            });
+            continue;
+        }
+
+        done += stored;
+        data_->not_empty_.notify(stored);
+    }
+}
+
+size_t PosixSharedRunQueue::dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    if (tasks.empty() || max == 0)
+        return 0;
+
+    while (true)
+    {
+        if (size_t taken = try_dequeue_bulk(tasks, max))
+            return taken;
+
+        data_->not_empty_.wait([this] { return size() > 0; });
+    }
+}
+
+size_t PosixSharedRunQueue::try_dequeue_bulk(std::span<SharedTask> tasks, size_t max)
+{
+    tasks = tasks.first(std::min(tasks.size(), max));
+    if (tasks.empty())
+        return 0;
+
+    size_t taken = try_pop(tasks);
+    if (taken != 0)
+        data_->not_full_.notify(taken);
+    return taken;
+}
+
+std::optional<SharedTask> PosixSharedRunQueue::try_dequeue()
+{
+    SharedTask task;
+    if (try_dequeue_bulk(std::span<SharedTask>(&task, 1), 1) == 0)
+        return std::nullopt;
+    return task;
+}
+
+std::optional<SharedTask> PosixSharedRunQueue::dequeue_for(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true)
+    {
+        if (auto task = try_dequeue())
+            return task;
+        if (std::chrono::steady_clock::now() >= deadline)
+            return std::nullopt;
+
+        data_->not_empty_.wait([this] { return size() > 0; }, deadline);
+    }
+}
+
+void PosixSharedRunQueue::for_each_slot(const std::function<void(const TaskView&)>& visitor)
+{
+    validate();
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed during visit");
+
+    try
+    {
+        for (uint64_t bitmap = data_->bitmap_; bitmap != 0; bitmap &= bitmap - 1)
+        {
+            size_t level = static_cast<size_t>(__builtin_ctzll(bitmap));
+            for (uint32_t node = data_->levels_[level].head_; node != NO_NODE; node = nodes_[node].next_)
+                visitor(descriptions_->view(nodes_[node].task_));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Error during visit: " + std::string(e.what()));
+        sem_post(mutex_sem_);
+        throw;
+    }
+
+    sem_post(mutex_sem_);
+}
+
+size_t PosixSharedRunQueue::try_push(std::span<const SharedTask> tasks)
+{
+    validate();
+
+    if (data_->count_.load(std::memory_order_relaxed) >= capacity_)
+        return 0;
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t stored = std::min(tasks.size(), capacity_ - data_->count_.load(std::memory_order_relaxed));
+
+    for (size_t i = 0; i < stored; ++i)
+    {
+        uint32_t node = data_->free_head_;
+        if (!descriptions_->store(tasks[i], nodes_[node].task_))
+        {
+            stored = i;
+            break;
+        }
+        data_->free_head_ = nodes_[node].next_;
+        nodes_[node].next_ = NO_NODE;
+
+        size_t index = level_of(tasks[i].priority_);
+        Level& level = data_->levels_[index];
+        if (level.tail_ == NO_NODE)
+            level.head_ = node;
+        else
+            nodes_[level.tail_].next_ = node;
+        level.tail_ = node;
+        data_->bitmap_ |= uint64_t{1} << index;
+    }
+
+    data_->count_.fetch_add(stored, std::memory_order_relaxed);
+    data_->total_enqueued_ += stored;
+
+    if (stored == 1)
+        LOG_TRACE_EVENT(logger_state_, "Enqueued task with id: {}", tasks[0].id_);
+    else if (stored > 1)
+        LOG_TRACE_EVENT(logger_state_, "Enqueued {} tasks starting with id: {}", stored, tasks[0].id_);
+
+    sem_post(mutex_sem_);
+    return stored;
+}
+
+size_t PosixSharedRunQueue::try_pop(std::span<SharedTask> tasks)
+{
+    validate();
+
+    if (data_->count_.load(std::memory_order_relaxed) == 0)
+        return 0;
+
+    if (sem_wait(mutex_sem_) == -1)
+        throw std::runtime_error("Mutex semaphore wait failed");
+
+    size_t taken = std::min(tasks.size(), data_->count_.load(std::memory_order_relaxed));
+
+    for (size_t i = 0; i < taken; ++i)
+    {
+        size_t index = static_cast<size_t>(__builtin_ctzll(data_->bitmap_));
+        Level& level = data_->levels_[index];
+
+        uint32_t node = level.head_;
+        descriptions_->load(nodes_[node].task_, tasks[i]);
+        level.head_ = nodes_[node].next_;
+        if (level.head_ == NO_NODE)
+        {
+            level.tail_ = NO_NODE;
+            data_->bitmap_ &= ~(uint64_t{1} << index);
+        }
+
+        nodes_[node].next_ = data_->free_head_;
+        data_->free_head_ = node;
+    }
+
+    data_->count_.fetch_sub(taken, std::memory_order_relaxed);
+    data_->total_dequeued_ += taken;
+
+    if (taken == 1)
+        LOG_TRACE_EVENT(logger_state_, "Dequeued task with id: {}", tasks[0].id_);
+    else if (taken > 1)
+        LOG_TRACE_EVENT(logger_state_, "Dequeued {} tasks starting with id: {}", taken, tasks[0].id_);
+
+    sem_post(mutex_sem_);
+    return taken;
+}
+
+void PosixSharedRunQueue::cleanup()
+{
+    try
+    {
+        destroy();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(logger_error_, "Failed to clean up shared memory: " + std::string(e.what()));
+    }
+    catch (...)
+    {
+        LOG_ERROR(logger_error_, "Unknown exception occurred during cleanup.");
+    }
+}
+
+void PosixSharedRunQueue::validate() const
+{
+    if (!data_)
+        throw std::runtime_error("Shared memory not attached");
+}
\ No newline at end of file
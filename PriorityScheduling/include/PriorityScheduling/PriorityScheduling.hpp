@@ -43,6 +43,16 @@ public:
      */
     void update_task_priority(std::shared_ptr<GeneralTask>) override;
 
+    /**
+     * @brief Sorts the shared queue by priority, so the queue order matches select_next_task.
+     *
+     * @return Always true.
+     */
+    [[nodiscard]] inline bool orders_by_priority() const noexcept override
+    {
+        return true;
+    }
+
     /**
      * @brief Returns the name of the scheduling algorithm.
      *
@@ -3,6 +3,8 @@
 #include <Sheduler/Sheduler.hpp>
 #include <Tasks/Tasks.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <memory>
@@ -12,10 +14,12 @@
 #include <sys/socket.h>
 #include <unistd.h>
 #include <unordered_map>
+#include <vector>
 
 #define PORT 8080
 #define SERVER "server_state"
 #define SERVER_ERROR "server_error"
+#define FIRST_CLIENT_TASK_ID 1000
 
 constexpr int SIZE = 1024;
 
@@ -30,14 +34,16 @@ static const std::unordered_map<std::string, int> operations
 class Server final
 {
 public:
-    explicit Server(): logger_(std::make_unique<ErrorLogger>(LOGS_DIR, SERVER_ERROR)),
-        logger_normal_(std::make_unique<FileLogger>(LOGS_DIR, SERVER)) {}
+    explicit Server(): next_id_(FIRST_CLIENT_TASK_ID),
+        logger_(std::make_unique<SharedLogger>(LOGS_DIR, SERVER_ERROR, OverflowPolicy::COUNT, LogFormat::ERROR)),
+        logger_normal_(std::make_unique<SharedLogger>(LOGS_DIR, SERVER)) {}
 
     void handle_client(int, Scheduler&);
 
     void start_server(Scheduler&);
 
 private:
+    std::atomic<int> next_id_; ///< Starts above every id in the queue when the server starts.
     std::shared_ptr<Logger> logger_;
     std::shared_ptr<Logger> logger_normal_;
 };
\ No newline at end of file
@@ -3,33 +3,47 @@
 void Server::handle_client(int client_socket, Scheduler& scheduler) 
 {
     char buffer[SIZE] = {0};
-    read(client_socket, buffer, sizeof(buffer));
-    std::string command(buffer);
-    logger_normal_->log("Received command: " + command);
+    read(client_socket, buffer, sizeof(buffer) - 1);
+    std::istringstream commands(buffer);
+    std::string command;
+    std::vector<std::shared_ptr<GeneralTask>> tasks;
 
-    std::istringstream iss(command);
-    std::string operation;
-    int num1, num2;
-
-    if (!(iss >> operation >> num1 >> num2)) 
+    while (std::getline(commands, command)) 
     {
-        logger_->log("Invalid command format");
-        close(client_socket);
-        return;
+        if (command.empty())
+            continue;
+        LOG_INFO(logger_normal_, "Received command: " + command);
+
+        std::istringstream iss(command);
+        std::string operation;
+        int num1, num2;
+
+        if (!(iss >> operation >> num1 >> num2)) 
+        {
+            LOG_ERROR(logger_, "Invalid command format");
+            continue;
+        }
+        auto it = operations.find(operation);
+        if (it != operations.cend())
+        {
+            auto task = std::make_shared<UnixTask>(next_id_++, operation);
+            task->set_static_priority(it->second);
+            tasks.emplace_back(task);
+            LOG_INFO(logger_normal_, "Task added: " + operation + " " + std::to_string(num1) + " and " + 
+            std::to_string(num2));
+        }    
+        else
+           LOG_ERROR(logger_, "Unknown operation: " + operation);
     }
-    auto it = operations.find(operation);
-    if (it != operations.cend())
-    {
-        auto task = std::make_shared<UnixTask>(it->second, operation);
-        task->set_static_priority(it->second);
-        scheduler.add_task(task);
-        logger_normal_->log("Task added: " + operation + " " + std::to_string(num1) + " and " + 
-        std::to_string(num2));
-   
-    }    
-    else
-       logger_->log("Unknown operation: " + operation);
 
+    try 
+    {
+        scheduler.add_tasks(tasks);
+    } 
+    catch (const std::exception& e) 
+    {
+        LOG_ERROR(logger_, "Tasks not added: " + std::string(e.what()));
+    }
     close(client_socket);
 }
 
@@ -40,15 +54,17 @@ void Server::start_server(Scheduler& scheduler)
     int opt = 1;
     int addrlen = sizeof(address);
 
+    next_id_ = std::max(FIRST_CLIENT_TASK_ID, scheduler.max_task_id() + 1);
+
     if ((server_fd = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
     {
-        logger_->log("Socket creation failed");
+        LOG_ERROR(logger_, "Socket creation failed");
         exit(EXIT_FAILURE);
     }
 
     if (setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR | SO_REUSEPORT, &opt, sizeof(opt))) 
     {
-        logger_->log("Setsockopt failed");
+        LOG_ERROR(logger_, "Setsockopt failed");
         exit(EXIT_FAILURE);
     }
 
@@ -58,24 +74,24 @@ void Server::start_server(Scheduler& scheduler)
 
     if (bind(server_fd, (struct sockaddr *)&address, sizeof(address)) < 0) 
     {
-        logger_->log("Bind failed");
+        LOG_ERROR(logger_, "Bind failed");
         exit(EXIT_FAILURE);
     }
 
     if (listen(server_fd, 3) < 0) 
     {
-        logger_->log("Listen failed");
+        LOG_ERROR(logger_, "Listen failed");
         exit(EXIT_FAILURE);
     }
 
     std::cout << "Server started on port " <<  std::to_string(PORT);
-    logger_normal_->log("Server started on port " + std::to_string(PORT));
+    LOG_INFO(logger_normal_, "Server started on port " + std::to_string(PORT));
 
     while (true) 
     {
         if ((new_socket = accept(server_fd, (struct sockaddr *)&address, (socklen_t *)&addrlen)) < 0) 
         {
-            logger_->log("Accept failed");
+            LOG_ERROR(logger_, "Accept failed");
             exit(EXIT_FAILURE);
         }
         std::thread([this, new_socket, &scheduler]() {
@@ -1,6 +1,8 @@
 #include <Sheduler/Sheduler.hpp>
 #include <Tasks/Tasks.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <netinet/in.h>
@@ -11,6 +13,8 @@
 #include <unordered_map>
 
 #define PORT 8080
+#define DOORBELL_SOCKET "/tmp/task_queue.doorbell"
+#define FIRST_CLIENT_TASK_ID 1000
 
 static const std::unordered_map<std::string, int> operations
 {
@@ -20,6 +24,8 @@ static const std::unordered_map<std::string, int> operations
     {"del", 16}
 };
 
+static std::atomic<int> next_id{FIRST_CLIENT_TASK_ID};
+
 void handle_client(int client_socket, Scheduler& scheduler) 
 {
     char buffer[1024] = {0};
@@ -41,10 +47,17 @@ void handle_client(int client_socket, Scheduler& scheduler)
     auto it = operations.find(operation);
     if (it != operations.cend())
     {
-        auto task = std::make_shared<UnixTask>(it->second, operation);
+        auto task = std::make_shared<UnixTask>(next_id++, operation);
         task->set_static_priority(it->second);
-        scheduler.add_task(task);
-        std::cout << "Task added: " << operation << " "  << num1 << " and "  << num2;
+        try 
+        {
+            scheduler.add_task(task);
+            std::cout << "Task added: " << operation << " "  << num1 << " and "  << num2;
+        } 
+        catch (const std::exception& e) 
+        {
+            std::cerr << "Task not added: " << e.what() << std::endl;
+        }
     }    
     else 
         std::cerr << "Unknown operation: " << operation << std::endl;
@@ -100,9 +113,10 @@ void start_server(Scheduler& scheduler)
     }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-    auto shm = std::make_shared<PosixSharedMemory>("/task_queue");
+    auto shm = argc > 1 ? std::make_shared<PosixSharedMemory>("/task_queue", argv[1])
+                        : std::make_shared<PosixSharedMemory>("/task_queue");
     try 
     {
         shm->create();
@@ -112,12 +126,17 @@ int main()
         shm->attach();
     }
 
+    auto doorbell = std::make_shared<Doorbell>();
+    shm->set_doorbell(doorbell);
+    DoorbellServer doorbell_server(doorbell, DOORBELL_SOCKET);
+
     Scheduler scheduler(shm);
+    next_id = std::max(FIRST_CLIENT_TASK_ID, scheduler.max_task_id() + 1);
 
     scheduler.start();
 
-    scheduler.add_task(std::make_shared<CpuIntensiveTask>(1, std::chrono::seconds(1)));
-    scheduler.add_task(std::make_shared<IoBoundTask>(2, "output.txt", 10));
+    scheduler.add_task(std::make_shared<CpuIntensiveTask>(next_id++, std::chrono::seconds(1)));
+    scheduler.add_task(std::make_shared<IoBoundTask>(next_id++, "output.txt", 10));
 
     start_server(scheduler);
 
@@ -0,0 +1,557 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#define DESCRIPTION_BYTES_PER_TASK 32
+#define DESCRIPTION_MIN_BYTES 4096
+
+/**
+ * @struct CompactTask
+ * @brief The in-segment representation of a SharedTask.
+ *
+ * The description is replaced by a reference into the DescriptionTable of the
+ * segment and the CPU usage is kept as a 16-bit fraction, which shrinks a stored
+ * task from 288 to 28 bytes. The deadline keeps the low 32 bits of its millisecond
+ * value and is widened again around the current time, which is exact for deadlines
+ * less than 24 days away.
+ */
+struct CompactTask
+{
+    int id_;
+    int priority_;
+    uint32_t description_;
+    uint32_t deadline_;
+    int remaining_work_;
+    float virtual_runtime_;
+    uint16_t cpu_usage_;
+    TaskType type_;
+    bool completed_;
+
+    /**
+     * @brief Packs a CPU usage in [0, 1] into a 16-bit fraction.
+     */
+    [[nodiscard]] static inline uint16_t pack_usage(float usage) noexcept
+    {
+        return static_cast<uint16_t>(std::lround(std::clamp(usage, 0.0f, 1.0f) * UINT16_MAX));
+    }
+
+    /**
+     * @brief Packs an absolute deadline in milliseconds into its low 32 bits, 0 meaning none.
+     */
+    [[nodiscard]] static inline uint32_t pack_deadline(int64_t deadline_ms) noexcept
+    {
+        if (deadline_ms == NO_DEADLINE_MS)
+            return 0;
+        auto packed = static_cast<uint32_t>(deadline_ms);
+        return packed == 0 ? 1 : packed;
+    }
+
+    /**
+     * @brief Gets the absolute deadline of the task in milliseconds.
+     */
+    [[nodiscard]] inline int64_t deadline() const noexcept
+    {
+        if (deadline_ == 0)
+            return NO_DEADLINE_MS;
+        int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        return now_ms + static_cast<int32_t>(deadline_ - static_cast<uint32_t>(now_ms));
+    }
+
+    /**
+     * @brief Gets the saved progress of the task.
+     */
+    [[nodiscard]] inline TaskProgress progress() const noexcept
+    {
+        return TaskProgress{remaining_work_, virtual_runtime_, static_cast<float>(cpu_usage_) / UINT16_MAX};
+    }
+};
+
+static_assert(sizeof(CompactTask) <= 28, "a compact task and a 32-bit sequence number must fit into 32 bytes");
+
+/**
+ * @class DescriptionTable
+ * @brief Reference-counted table of interned task descriptions placed inside a shared segment.
+ *
+ * Every distinct description is stored once as a length-prefixed record in a byte
+ * arena; stored tasks hold the record's unit offset and a reference. The record is
+ * freed when its last task is loaded out of the segment. An open-addressing index
+ * finds records by text.
+ *
+ * The table has no constructor: the segment creator calls reset(), after which
+ * the table is followed in memory by the allocation bitmap, the index and an arena
+ * of `bytes` bytes, `footprint(bytes)` bytes in total. The arena is divided into
+ * UNIT-byte units and a record takes the first run of free units that fits it,
+ * so records are packed at the start of the arena and only the pages that were
+ * ever used become resident. A full arena makes store() fail until tasks are loaded.
+ *
+ * No operation takes a lock. Records carry atomic reference counts: intern() takes
+ * a reference by CAS only while the count is positive and checks the text again
+ * afterwards, because the record may have been freed and reused for another text
+ * in between. Units are claimed and freed by CAS on the bitmap, index buckets by CAS
+ * from an empty or deleted bucket. Two processes interning the same new text at the
+ * same time may both create a record; both stay valid and are freed independently.
+ */
+class DescriptionTable
+{
+public:
+    static constexpr uint32_t NO_DESCRIPTION = UINT32_MAX;
+    static constexpr size_t UNIT = 32;
+
+    /**
+     * @struct Record
+     * @brief The header of one interned description, followed by its text and a terminating zero.
+     */
+    struct Record
+    {
+        std::atomic<uint32_t> references_;
+        std::atomic<uint32_t> hash_;
+        std::atomic<uint32_t> length_;
+    };
+
+    /**
+     * @brief Computes the number of units of an arena of at least the given size.
+     *
+     * The arena grows to whole bitmap words.
+     */
+    [[nodiscard]] static constexpr size_t arena_units(size_t bytes) noexcept
+    {
+        size_t units = (bytes + UNIT - 1) / UNIT;
+        return (units + WORD_UNITS - 1) / WORD_UNITS * WORD_UNITS;
+    }
+
+    /**
+     * @brief Computes the number of index buckets for an arena of the given number of units.
+     *
+     * Every record takes at least one unit, so the index is never more than half full.
+     */
+    [[nodiscard]] static constexpr size_t index_size(size_t units) noexcept
+    {
+        size_t size = 1;
+        while (size < 2 * units)
+            size <<= 1;
+        return size;
+    }
+
+    /**
+     * @brief Computes the size in bytes of a table with an arena of at least the given size.
+     */
+    [[nodiscard]] static constexpr size_t footprint(size_t bytes) noexcept
+    {
+        size_t units = arena_units(bytes);
+        return sizeof(DescriptionTable) + (units / WORD_UNITS + index_size(units)) * sizeof(uint32_t) + units * UNIT;
+    }
+
+    /**
+     * @brief Picks the arena size for a queue of the given capacity.
+     *
+     * DESCRIPTION_BYTES_PER_TASK bytes per task hold one short distinct description for
+     * every task; longer or more descriptions than that make producers wait for consumers.
+     * DESCRIPTION_MIN_BYTES keeps room for several descriptions of MAX_PATH characters.
+     *
+     * @param capacity The number of tasks the queue can hold.
+     * @return The arena size in bytes.
+     */
+    [[nodiscard]] static constexpr size_t default_bytes(size_t capacity) noexcept
+    {
+        return std::max<size_t>(capacity * DESCRIPTION_BYTES_PER_TASK, DESCRIPTION_MIN_BYTES);
+    }
+
+    /**
+     * @brief Initializes an empty table with an arena of at least `bytes` bytes in place.
+     *
+     * Only the bitmap and the index are written; the arena is left untouched.
+     */
+    void reset(size_t bytes) noexcept
+    {
+        size_t units = arena_units(bytes);
+        words_ = static_cast<uint32_t>(units / WORD_UNITS);
+        index_mask_ = static_cast<uint32_t>(index_size(units) - 1);
+        used_.store(0, std::memory_order_relaxed);
+
+        for (uint32_t i = 0; i < words_; ++i)
+            bitmap()[i].store(0, std::memory_order_relaxed);
+        for (uint32_t i = 0; i <= index_mask_; ++i)
+            index()[i].store(EMPTY, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the size of the arena in bytes.
+     */
+    [[nodiscard]] inline size_t bytes() const noexcept
+    {
+        return static_cast<size_t>(words_) * WORD_UNITS * UNIT;
+    }
+
+    /**
+     * @brief Gets the number of distinct descriptions currently referenced.
+     */
+    [[nodiscard]] inline size_t used() const noexcept
+    {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether the arena has room for a new record holding `text`.
+     *
+     * Producers wait for this after store() failed; an interned text needs no room.
+     */
+    [[nodiscard]] bool available(const char* text) const noexcept
+    {
+        size_t units = units_for(strnlen(text, MAX_PATH - 1));
+        for (uint32_t word = 0; word < words_; ++word)
+            if (run_starts(bitmap()[word].load(std::memory_order_relaxed), units) != 0)
+                return true;
+        return false;
+    }
+
+    /**
+     * @brief Converts a task into its compact form, taking a reference on its description.
+     *
+     * @param task The task to store.
+     * @param slot Receives the compact task.
+     * @return False if the description is new and the arena has no room for it; `slot` is untouched then.
+     */
+    bool store(const SharedTask& task, CompactTask& slot) noexcept
+    {
+        uint32_t description = intern(task.description_);
+        if (description == NO_DESCRIPTION)
+            return false;
+
+        slot = CompactTask{task.id_, task.priority_, description, CompactTask::pack_deadline(task.deadline_ms_),
+            task.progress_.remaining_work_, task.progress_.virtual_runtime_,
+            CompactTask::pack_usage(task.progress_.cpu_usage_), task.type_, task.completed_};
+        return true;
+    }
+
+    /**
+     * @brief Converts a compact task back and drops its reference on the description.
+     *
+     * @param slot The compact task, it no longer references the table afterwards.
+     * @param task Receives the full task.
+     */
+    void load(const CompactTask& slot, SharedTask& task) noexcept
+    {
+        peek(slot, task);
+        release(slot.description_);
+    }
+
+    /**
+     * @brief Converts a compact task back without dropping its reference.
+     *
+     * @param slot The compact task.
+     * @param task Receives the full task.
+     */
+    void peek(const CompactTask& slot, SharedTask& task) const noexcept
+    {
+        task.id_ = slot.id_;
+        task.priority_ = slot.priority_;
+        task.type_ = slot.type_;
+        task.completed_ = slot.completed_;
+        task.progress_ = slot.progress();
+        task.deadline_ms_ = slot.deadline();
+
+        size_t length = std::min<size_t>(record(slot.description_).length_.load(std::memory_order_relaxed), MAX_PATH - 1);
+        std::memcpy(task.description_, text(slot.description_), length);
+        std::memset(task.description_ + length, 0, MAX_PATH - length);
+    }
+
+    /**
+     * @brief Views a compact task with its description in place.
+     *
+     * @param slot The compact task.
+     * @return The view, valid while the task stays stored.
+     */
+    [[nodiscard]] TaskView view(const CompactTask& slot) const noexcept
+    {
+        return TaskView{slot.id_, slot.priority_, text(slot.description_), slot.type_, slot.completed_,
+            slot.progress(), slot.deadline()};
+    }
+
+    /**
+     * @brief Gets the bytes of the record a stored task references.
+     *
+     * A file-backed queue flushes them before it commits the task.
+     *
+     * @param description The unit offset returned by intern().
+     */
+    [[nodiscard]] std::span<const char> record_bytes(uint32_t description) const noexcept
+    {
+        return std::span<const char>(reinterpret_cast<const char*>(&record(description)),
+            units_for(record(description).length_.load(std::memory_order_relaxed)) * UNIT);
+    }
+
+    /**
+     * @brief Takes a reference on a record holding `text`, interning it if necessary.
+     *
+     * @param text The description, truncated to MAX_PATH - 1 characters.
+     * @return The unit offset of the record, or NO_DESCRIPTION if the text is new and the arena is full.
+     */
+    uint32_t intern(const char* text) noexcept
+    {
+        size_t length = strnlen(text, MAX_PATH - 1);
+        uint32_t hash = fnv1a(text, length);
+
+        uint32_t bucket = hash & index_mask_;
+        for (uint32_t probe = 0; probe <= index_mask_; ++probe, bucket = (bucket + 1) & index_mask_)
+        {
+            uint32_t candidate = index()[bucket].load(std::memory_order_acquire);
+            if (candidate == EMPTY)
+                break;
+            if (candidate != DELETED && acquire(candidate, hash, text, length))
+                return candidate;
+        }
+
+        uint32_t created = allocate(units_for(length));
+        if (created == NO_DESCRIPTION)
+            return NO_DESCRIPTION;
+
+        Record& fresh = record(created);
+        std::memcpy(this->text(created), text, length);
+        this->text(created)[length] = '\0';
+        fresh.length_.store(static_cast<uint32_t>(length), std::memory_order_relaxed);
+        fresh.hash_.store(hash, std::memory_order_relaxed);
+        fresh.references_.store(1, std::memory_order_release);
+
+        for (bucket = hash & index_mask_; ; bucket = (bucket + 1) & index_mask_)
+        {
+            uint32_t current = index()[bucket].load(std::memory_order_relaxed);
+            if ((current == EMPTY || current == DELETED) &&
+                index()[bucket].compare_exchange_strong(current, created, std::memory_order_release))
+                break;
+        }
+        used_.fetch_add(1, std::memory_order_relaxed);
+        return created;
+    }
+
+    /**
+     * @brief Drops one reference, freeing the record when it was the last one.
+     *
+     * @param description The unit offset returned by intern().
+     */
+    void release(uint32_t description) noexcept
+    {
+        Record& released = record(description);
+        if (released.references_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        uint32_t bucket = released.hash_.load(std::memory_order_relaxed) & index_mask_;
+        for (uint32_t probe = 0; probe <= index_mask_; ++probe, bucket = (bucket + 1) & index_mask_)
+        {
+            uint32_t current = description;
+            if (index()[bucket].load(std::memory_order_relaxed) == description &&
+                index()[bucket].compare_exchange_strong(current, DELETED, std::memory_order_relaxed))
+                break;
+        }
+
+        size_t units = units_for(released.length_.load(std::memory_order_relaxed));
+        bitmap()[description / WORD_UNITS].fetch_and(~(run_mask(units) << (description % WORD_UNITS)), 
+            std::memory_order_release);
+        used_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Rebuilds reference counts, the bitmap and the index from the stored tasks.
+     *
+     * Used when a persistent segment is reopened: references taken by enqueues or
+     * dropped by dequeues that never committed are discarded, record texts are kept.
+     * Records no stored task references are freed.
+     *
+     * @param for_each_task Calls its argument with every stored CompactTask.
+     * @return False if a stored task references a unit that cannot hold a record.
+     */
+    template <typename ForEachTask>
+    bool recover(ForEachTask for_each_task) noexcept
+    {
+        bool valid = true;
+        for_each_task([this, &valid](const CompactTask& task)
+        {
+            if (holds_record(task.description_))
+                record(task.description_).references_.store(0, std::memory_order_relaxed);
+            else
+                valid = false;
+        });
+        if (!valid)
+            return false;
+
+        for_each_task([this](const CompactTask& task)
+        {
+            record(task.description_).references_.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        used_.store(0, std::memory_order_relaxed);
+        for (uint32_t i = 0; i < words_; ++i)
+            bitmap()[i].store(0, std::memory_order_relaxed);
+        for (uint32_t i = 0; i <= index_mask_; ++i)
+            index()[i].store(EMPTY, std::memory_order_relaxed);
+
+        for_each_task([this, &valid](const CompactTask& task)
+        {
+            uint32_t description = task.description_;
+            std::atomic<uint32_t>& word = bitmap()[description / WORD_UNITS];
+            uint32_t run = run_mask(units_for(record(description).length_.load(std::memory_order_relaxed))) << 
+                (description % WORD_UNITS);
+            uint32_t first = 1u << (description % WORD_UNITS);
+            if ((word.load(std::memory_order_relaxed) & first) != 0)
+                return;
+            if ((word.load(std::memory_order_relaxed) & run) != 0)
+            {
+                valid = false;
+                return;
+            }
+
+            word.fetch_or(run, std::memory_order_relaxed);
+            uint32_t bucket = record(description).hash_.load(std::memory_order_relaxed) & index_mask_;
+            while (index()[bucket].load(std::memory_order_relaxed) != EMPTY)
+                bucket = (bucket + 1) & index_mask_;
+            index()[bucket].store(description, std::memory_order_relaxed);
+            used_.fetch_add(1, std::memory_order_relaxed);
+        });
+        return valid;
+    }
+
+private:
+    static constexpr size_t WORD_UNITS = 32;
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+    static constexpr uint32_t DELETED = UINT32_MAX - 1;
+
+    static inline uint32_t fnv1a(const char* text, size_t length) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; ++i)
+            hash = (hash ^ static_cast<unsigned char>(text[i])) * 16777619u;
+        return hash;
+    }
+
+    /**
+     * @brief Computes the number of units of a record holding a text of the given length.
+     */
+    static constexpr size_t units_for(size_t length) noexcept
+    {
+        return (sizeof(Record) + std::min<size_t>(length, MAX_PATH - 1) + 1 + UNIT - 1) / UNIT;
+    }
+
+    static constexpr uint32_t run_mask(size_t units) noexcept
+    {
+        return units >= WORD_UNITS ? UINT32_MAX : (1u << units) - 1;
+    }
+
+    /**
+     * @brief Gets the bitmap bits at which a run of `units` free units starts.
+     */
+    static inline uint32_t run_starts(uint32_t word, size_t units) noexcept
+    {
+        uint32_t free = ~word;
+        uint32_t starts = free;
+        for (size_t i = 1; i < units; ++i)
+            starts &= free >> i;
+        return starts;
+    }
+
+    /**
+     * @brief Claims the first run of free units that holds `units` units.
+     *
+     * @return The unit offset of the run, or NO_DESCRIPTION if the arena is full.
+     */
+    uint32_t allocate(size_t units) noexcept
+    {
+        for (uint32_t word = 0; word < words_; ++word)
+        {
+            uint32_t bits = bitmap()[word].load(std::memory_order_relaxed);
+            while (uint32_t starts = run_starts(bits, units))
+            {
+                int first = std::countr_zero(starts);
+                if (bitmap()[word].compare_exchange_weak(bits, bits | (run_mask(units) << first),
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                    return static_cast<uint32_t>(word * WORD_UNITS + first);
+            }
+        }
+        return NO_DESCRIPTION;
+    }
+
+    /**
+     * @brief Takes a reference on a record if it is live and holds `text`.
+     */
+    bool acquire(uint32_t description, uint32_t hash, const char* text, size_t length) noexcept
+    {
+        Record& candidate = record(description);
+        if (candidate.hash_.load(std::memory_order_relaxed) != hash)
+            return false;
+
+        uint32_t references = candidate.references_.load(std::memory_order_relaxed);
+        do
+        {
+            if (references == 0)
+                return false;
+        } while (!candidate.references_.compare_exchange_weak(references, references + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed));
+
+        if (candidate.hash_.load(std::memory_order_relaxed) == hash &&
+            candidate.length_.load(std::memory_order_relaxed) == length &&
+            std::memcmp(this->text(description), text, length) == 0)
+            return true;
+
+        release(description);
+        return false;
+    }
+
+    /**
+     * @brief Checks whether a stored unit offset can start a record inside the arena.
+     */
+    [[nodiscard]] bool holds_record(uint32_t description) const noexcept
+    {
+        if (description >= words_ * WORD_UNITS)
+            return false;
+        size_t units = units_for(record(description).length_.load(std::memory_order_relaxed));
+        return description % WORD_UNITS + units <= WORD_UNITS;
+    }
+
+    inline std::atomic<uint32_t>* bitmap() noexcept
+    {
+        return reinterpret_cast<std::atomic<uint32_t>*>(this + 1);
+    }
+
+    inline const std::atomic<uint32_t>* bitmap() const noexcept
+    {
+        return reinterpret_cast<const std::atomic<uint32_t>*>(this + 1);
+    }
+
+    inline std::atomic<uint32_t>* index() noexcept
+    {
+        return bitmap() + words_;
+    }
+
+    inline Record& record(uint32_t description) noexcept
+    {
+        return *reinterpret_cast<Record*>(reinterpret_cast<char*>(index() + index_mask_ + 1) + description * UNIT);
+    }
+
+    inline const Record& record(uint32_t description) const noexcept
+    {
+        return *reinterpret_cast<const Record*>(
+            reinterpret_cast<const char*>(bitmap() + words_ + index_mask_ + 1) + description * UNIT);
+    }
+
+    inline char* text(uint32_t description) noexcept
+    {
+        return reinterpret_cast<char*>(&record(description) + 1);
+    }
+
+    inline const char* text(uint32_t description) const noexcept
+    {
+        return reinterpret_cast<const char*>(&record(description) + 1);
+    }
+
+    uint32_t words_;
+    uint32_t index_mask_;
+    std::atomic<uint32_t> used_;
+};
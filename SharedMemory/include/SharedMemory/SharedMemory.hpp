@@ -2,24 +2,37 @@
 
 #include <Task/Task.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <span>
 #include <vector>
 
 #define MAX_PATH 256
-
-enum class TaskType 
-{ 
-    UNIX_TASK, 
-    CPU_INTENSIVE_TASK, 
-    IO_BOUND_TASK 
-};
+#define CACHE_LINE 64
+#define COUNT_TASKS 100
+#define THROW_VALUE (1 << 20)
+#define ERROR_DIR "error_log"
+#define MIN_PRIORITY (-20)
+#define MAX_PRIORITY 19
+#define PRIORITY_LEVELS (MAX_PRIORITY - MIN_PRIORITY + 1)
+#define NO_DEADLINE_MS 0
 
 /**
  * @struct SharedTask
  * @brief Represents a task stored in shared memory.
  *
  * This structure defines the layout of a task that is stored in shared memory.
- * It includes metadata such as task ID, priority, description, completion
- * status, and remaining execution time.
+ * It includes metadata such as task ID, priority, description and completion
+ * status, and the progress saved by the task so that a requeued task resumes
+ * where it stopped; its remaining work is the remaining execution time.
+ *
+ * The absolute deadline is kept in milliseconds of std::chrono::steady_clock,
+ * which is CLOCK_MONOTONIC and therefore comparable between processes;
+ * NO_DEADLINE_MS marks a task without a deadline.
  */
 
 struct SharedTask 
@@ -29,9 +42,54 @@ struct SharedTask
     char description_[MAX_PATH];
     TaskType type_;
     bool completed_;
-    int remaining_time_ms_;
+    TaskProgress progress_{};
+    int64_t deadline_ms_ = NO_DEADLINE_MS;
+};
+
+/**
+ * @struct TaskView
+ * @brief A read-only view of a task stored in shared memory.
+ *
+ * The description points into the segment and is only valid while the visitor
+ * that received the view runs.
+ */
+struct TaskView
+{
+    int id_;
+    int priority_;
+    const char* description_;
+    TaskType type_;
+    bool completed_;
+    TaskProgress progress_;
+    int64_t deadline_ms_;
+
+    /**
+     * @brief Copies the viewed task out of the segment.
+     *
+     * @param task Receives the task.
+     */
+    void copy_to(SharedTask& task) const noexcept
+    {
+        task.id_ = id_;
+        task.priority_ = priority_;
+        std::strncpy(task.description_, description_, MAX_PATH - 1);
+        task.description_[MAX_PATH - 1] = '\0';
+        task.type_ = type_;
+        task.completed_ = completed_;
+        task.progress_ = progress_;
+        task.deadline_ms_ = deadline_ms_;
+    }
 };
 
+/**
+ * @brief Creates a view of a task held outside the segment.
+ */
+inline TaskView view_of(const SharedTask& task) noexcept
+{
+    return TaskView{task.id_, task.priority_, task.description_, task.type_, task.completed_, task.progress_,
+        task.deadline_ms_};
+}
+
 /**
  * @class SharedMemory
  * @brief Abstract base class defining the interface for shared memory
@@ -96,6 +154,46 @@ public:
      */
     virtual SharedTask dequeue() = 0;
 
+    /**
+     * @brief Enqueues a batch of tasks into the shared memory.
+     *
+     * @param tasks The tasks to be added to the shared memory, in order.
+     */
+    virtual void enqueue_bulk(std::span<const SharedTask>) = 0;
+
+    /**
+     * @brief Dequeues a batch of tasks from the shared memory.
+     *
+     * @param tasks Receives the tasks retrieved from the shared memory.
+     * @param max The maximum number of tasks to retrieve.
+     * @return The number of tasks retrieved.
+     */
+    virtual size_t dequeue_bulk(std::span<SharedTask>, size_t) = 0;
+
+    /**
+     * @brief Dequeues a batch of tasks without blocking.
+     *
+     * @param tasks Receives the tasks retrieved from the shared memory.
+     * @param max The maximum number of tasks to retrieve.
+     * @return The number of tasks retrieved, 0 if the shared memory is empty.
+     */
+    virtual size_t try_dequeue_bulk(std::span<SharedTask>, size_t) = 0;
+
+    /**
+     * @brief Dequeues a task without blocking.
+     *
+     * @return The task retrieved, or std::nullopt if the shared memory is empty.
+     */
+    virtual std::optional<SharedTask> try_dequeue() = 0;
+
+    /**
+     * @brief Dequeues a task, waiting at most for the given timeout.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return The task retrieved, or std::nullopt if the timeout expired.
+     */
+    virtual std::optional<SharedTask> dequeue_for(std::chrono::milliseconds) = 0;
+
     /**
      * @brief Gets the current number of tasks in the shared memory.
      *
@@ -124,4 +222,80 @@ public:
      * memory.
      */
     virtual size_t capacity() const noexcept = 0;
+
+    /**
+     * @brief Sets the scheduler running flag stored in the shared memory.
+     *
+     * @param running The new status of the scheduler.
+     */
+    virtual void set_scheduler_running(bool) = 0;
+
+    /**
+     * @brief Checks the scheduler running flag stored in the shared memory.
+     *
+     * @return True if the scheduler is running, false otherwise.
+     */
+    virtual bool is_scheduler_running() const = 0;
+
+    /**
+     * @brief Checks whether the shared memory itself orders tasks by priority.
+     *
+     * Queues that dequeue the highest SharedTask::priority_ first do not need
+     * to be drained and rebuilt to apply priority scheduling.
+     *
+     * @return True if dequeue() returns tasks in priority order, false if in FIFO order.
+     */
+    virtual bool is_priority_ordered() const noexcept = 0;
+
+    /**
+     * @brief Calls a visitor with every stored task, in place.
+     *
+     * The queue is locked while the visitor runs, so the visitor must be short and
+     * must not call back into the queue. Implementations document the visiting order.
+     *
+     * @param visitor Called once per stored task.
+     */
+    virtual void for_each_slot(const std::function<void(const TaskView&)>&) = 0;
+
+    /**
+     * @brief Copies the stored tasks out of the shared memory in dequeue order.
+     *
+     * @param tasks Receives up to tasks.size() tasks.
+     * @return The number of tasks written to `tasks`.
+     */
+    virtual size_t snapshot(std::span<SharedTask> tasks)
+    {
+        size_t count = 0;
+        for_each_slot([&tasks, &count](const TaskView& task)
+        {
+            if (count < tasks.size())
+                task.copy_to(tasks[count++]);
+        });
+        return count;
+    }
+
+    /**
+     * @brief Prints the stored tasks to standard output.
+     *
+     * Formats a snapshot after the queue lock is released. Meant for debugging;
+     * nothing on the enqueue or dequeue path calls it.
+     */
+    virtual void print()
+    {
+        std::vector<SharedTask> tasks(size());
+        tasks.resize(snapshot(tasks));
+
+        if (tasks.empty())
+            std::cout << "  [Empty]" << std::endl;
+        for (const auto& task : tasks)
+        {
+            std::cout << "  Task ID: " << task.id_
+                      << ", Priority: " << task.priority_
+                      << ", Description: " << task.description_
+                      << ", Completed: " << (task.completed_ ? "Yes" : "No")
+                      << ", Remaining Work: " << task.progress_.remaining_work_
+                      << ", Deadline: " << task.deadline_ms_ << " ms"
+                      << std::endl;
+        }
+    }
 };
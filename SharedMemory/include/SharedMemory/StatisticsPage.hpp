@@ -0,0 +1,296 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <unistd.h>
+
+#define STATISTICS_STALL_MS 100
+
+/**
+ * @struct QueueStatistics
+ * @brief A copy of the statistics of a shared queue.
+ *
+ * Per-priority counters are indexed by priority level, 0 for MAX_PRIORITY and
+ * PRIORITY_LEVELS - 1 for MIN_PRIORITY; priorities outside the range are clamped.
+ */
+struct QueueStatistics
+{
+    uint64_t total_enqueued_;
+    uint64_t total_dequeued_;
+    uint64_t high_water_mark_;
+    uint64_t producer_blocked_ns_;
+    uint64_t consumer_idle_ns_;
+    uint64_t enqueued_[PRIORITY_LEVELS];
+    uint64_t dequeued_[PRIORITY_LEVELS];
+
+    /**
+     * @brief Maps a task priority to the index of its per-priority counters.
+     */
+    [[nodiscard]] static constexpr size_t level_of(int priority) noexcept
+    {
+        return static_cast<size_t>(MAX_PRIORITY - std::clamp(priority, MIN_PRIORITY, MAX_PRIORITY));
+    }
+
+    /**
+     * @brief Gets the number of queued tasks with the given priority.
+     */
+    [[nodiscard]] inline uint64_t queued(int priority) const noexcept
+    {
+        return enqueued_[level_of(priority)] - dequeued_[level_of(priority)];
+    }
+};
+
+/**
+ * @class StatisticsPage
+ * @brief Queue statistics placed inside a shared segment and published through a seqlock.
+ *
+ * Writers serialize on the sequence number: a writer moves it from even to odd, updates
+ * the counters and moves it to the next even value. The lower 32 bits of the sequence
+ * are the version, the upper 32 bits of an odd sequence the process id of the writer
+ * holding it. Readers copy the counters and retry if the sequence was odd or changed
+ * meanwhile, so a snapshot is always one consistent state of the page, and a monitoring
+ * process can take it without touching the queue lock.
+ *
+ * A writer that dies inside an update would leave the sequence odd. A writer or reader
+ * that sees the same odd sequence for STATISTICS_STALL_MS checks whether its holder is
+ * still alive, and takes over or releases the page if it is not; the counters then keep
+ * whatever part of the update the dead writer made. Since a process id can be reused,
+ * recover() also releases the page when a persistent segment is reopened.
+ *
+ * The page has no constructor: the segment creator calls reset().
+ */
+class StatisticsPage
+{
+public:
+
+    /**
+     * @brief Clears all counters.
+     */
+    void reset() noexcept
+    {
+        sequence_.store(0, std::memory_order_relaxed);
+        for (auto* counter : {&total_enqueued_, &total_dequeued_, &high_water_mark_,
+                              &producer_blocked_ns_, &consumer_idle_ns_})
+            counter->store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < PRIORITY_LEVELS; ++i)
+        {
+            enqueued_[i].store(0, std::memory_order_relaxed);
+            dequeued_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Releases the page from a writer that died inside an update.
+     *
+     * Only valid while no other writer is active, i.e. when a segment is reopened.
+     */
+    void recover() noexcept
+    {
+        sequence_.store(released(sequence_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts a stored batch.
+     *
+     * @param tasks The tasks that were stored.
+     * @param depth The queue depth after storing them.
+     */
+    void record_enqueue(std::span<const SharedTask> tasks, size_t depth) noexcept
+    {
+        uint64_t sequence = begin_write();
+        add(total_enqueued_, tasks.size());
+        if (depth > high_water_mark_.load(std::memory_order_relaxed))
+            high_water_mark_.store(depth, std::memory_order_relaxed);
+        for (const auto& task : tasks)
+            add(enqueued_[QueueStatistics::level_of(task.priority_)], 1);
+        end_write(sequence);
+    }
+
+    /**
+     * @brief Counts a retrieved batch.
+     *
+     * @param tasks The tasks that were retrieved.
+     */
+    void record_dequeue(std::span<const SharedTask> tasks) noexcept
+    {
+        uint64_t sequence = begin_write();
+        add(total_dequeued_, tasks.size());
+        for (const auto& task : tasks)
+            add(dequeued_[QueueStatistics::level_of(task.priority_)], 1);
+        end_write(sequence);
+    }
+
+    /**
+     * @brief Adds time a producer spent waiting for a free slot.
+     */
+    void record_producer_blocked(std::chrono::nanoseconds blocked) noexcept
+    {
+        uint64_t sequence = begin_write();
+        add(producer_blocked_ns_, blocked.count());
+        end_write(sequence);
+    }
+
+    /**
+     * @brief Adds time a consumer spent waiting for a task.
+     */
+    void record_consumer_idle(std::chrono::nanoseconds idle) noexcept
+    {
+        uint64_t sequence = begin_write();
+        add(consumer_idle_ns_, idle.count());
+        end_write(sequence);
+    }
+
+    /**
+     * @brief Copies all counters as of one point in time.
+     *
+     * @return The statistics; never blocks a writer.
+     */
+    [[nodiscard]] QueueStatistics snapshot() const noexcept
+    {
+        QueueStatistics statistics;
+        Stall stall;
+        while (true)
+        {
+            uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                if (stall.abandoned(before))
+                    sequence_.compare_exchange_strong(before, released(before), std::memory_order_relaxed);
+                else
+                    std::this_thread::yield();
+                continue;
+            }
+
+            statistics.total_enqueued_ = total_enqueued_.load(std::memory_order_relaxed);
+            statistics.total_dequeued_ = total_dequeued_.load(std::memory_order_relaxed);
+            statistics.high_water_mark_ = high_water_mark_.load(std::memory_order_relaxed);
+            statistics.producer_blocked_ns_ = producer_blocked_ns_.load(std::memory_order_relaxed);
+            statistics.consumer_idle_ns_ = consumer_idle_ns_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < PRIORITY_LEVELS; ++i)
+            {
+                statistics.enqueued_[i] = enqueued_[i].load(std::memory_order_relaxed);
+                statistics.dequeued_[i] = dequeued_[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before)
+                return statistics;
+        }
+    }
+
+private:
+    static constexpr uint64_t VERSION_MASK = 0xffffffffull;
+
+    /**
+     * @struct Stall
+     * @brief Tracks how long one odd sequence has been seen.
+     */
+    struct Stall
+    {
+        uint64_t sequence_ = 0;
+        std::chrono::steady_clock::time_point since_;
+
+        /**
+         * @brief Checks whether the writer holding `sequence` stalled and died.
+         */
+        bool abandoned(uint64_t sequence) noexcept
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (sequence != sequence_)
+            {
+                sequence_ = sequence;
+                since_ = now;
+                return false;
+            }
+            if (now - since_ < std::chrono::milliseconds(STATISTICS_STALL_MS))
+                return false;
+            since_ = now;
+            auto holder = static_cast<pid_t>(sequence >> 32);
+            return kill(holder, 0) == -1 && errno == ESRCH;
+        }
+    };
+
+    /**
+     * @brief Gets the odd sequence that marks the page as held by this process.
+     */
+    static inline uint64_t held(uint64_t version) noexcept
+    {
+        return ((version & VERSION_MASK) | 1) | (static_cast<uint64_t>(getpid()) << 32);
+    }
+
+    /**
+     * @brief Gets the even sequence that follows a held one.
+     */
+    static inline uint64_t released(uint64_t sequence) noexcept
+    {
+        return sequence & 1 ? ((sequence & VERSION_MASK) + 1) & VERSION_MASK : sequence;
+    }
+
+    /**
+     * @brief Takes the page for an update.
+     *
+     * @return The odd sequence that holds the page.
+     */
+    inline uint64_t begin_write() noexcept
+    {
+        Stall stall;
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (!(sequence & 1))
+            {
+                uint64_t holding = held(sequence + 1);
+                if (sequence_.compare_exchange_weak(sequence, holding, std::memory_order_acquire))
+                {
+                    sequence = holding;
+                    break;
+                }
+                continue;
+            }
+
+            // The version of a dead holder is skipped, so a reader that saw it retries.
+            uint64_t holding = held(sequence + 2);
+            if (stall.abandoned(sequence) && sequence_.compare_exchange_strong(sequence, holding, std::memory_order_acquire))
+            {
+                sequence = holding;
+                break;
+            }
+            std::this_thread::yield();
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    /**
+     * @brief Publishes an update.
+     *
+     * @param sequence The sequence returned by begin_write().
+     */
+    inline void end_write(uint64_t sequence) noexcept
+    {
+        sequence_.store(released(sequence), std::memory_order_release);
+    }
+
+    static inline void add(std::atomic<uint64_t>& counter, uint64_t value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    alignas(CACHE_LINE) mutable std::atomic<uint64_t> sequence_;
+    alignas(CACHE_LINE) std::atomic<uint64_t> total_enqueued_;
+    std::atomic<uint64_t> total_dequeued_;
+    std::atomic<uint64_t> high_water_mark_;
+    std::atomic<uint64_t> producer_blocked_ns_;
+    std::atomic<uint64_t> consumer_idle_ns_;
+    std::atomic<uint64_t> enqueued_[PRIORITY_LEVELS];
+    std::atomic<uint64_t> dequeued_[PRIORITY_LEVELS];
+};
\ No newline at end of file
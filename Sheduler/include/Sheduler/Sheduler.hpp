@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Logger/Logger.hpp>
+#include <Logger/SharedLogChannel.hpp>
 #include <TaskProcessor/TaskProcessor.hpp>
 #include <TaskQueueManager/TaskQueueManager.hpp>
 #include <RoundRobinScheduling/RoundRobingScheduling.hpp>
@@ -23,13 +23,14 @@ public:
      *
      * Initializes the TaskQueueManager, TaskProcessor, and default scheduling algorithm (RoundRobinScheduling).
      *
-     * @param shm Shared pointer to the PosixSharedMemory object.
+     * @param shm Shared pointer to the SharedMemory object holding the task queue.
      */
-    Scheduler(std::shared_ptr<PosixSharedMemory> shm): 
+    Scheduler(std::shared_ptr<SharedMemory> shm): 
         queue_manager_(std::make_shared<TaskQueueManager>(shm)),
         processor_(std::make_shared<TaskProcessor>(queue_manager_, std::chrono::milliseconds(100))),
         current_algorithm_(std::make_unique<RoundRobinScheduling>()),
-        shm_(shm), running_(false), logger_(std::make_shared<ErrorLogger>(LOGS_DIR, STATE_SCHEDULER)){}
+        shm_(shm), running_(false), 
+        logger_(std::make_shared<SharedLogger>(LOGS_DIR, STATE_SCHEDULER, OverflowPolicy::COUNT, LogFormat::ERROR)){}
 
     /**
      * @brief Starts the scheduler and its associated components.
@@ -61,6 +62,16 @@ public:
      */
     void add_task(std::shared_ptr<GeneralTask>);
 
+    /**
+     * @brief Adds a batch of tasks to the task queue.
+     *
+     * Enqueues all tasks with a single bulk operation and reorders the queue
+     * once based on the current scheduling algorithm.
+     *
+     * @param tasks The tasks to be added, in order.
+     */
+    void add_tasks(const std::vector<std::shared_ptr<GeneralTask>>&);
+
     /**
      * @brief Retrieves the current number of tasks in the queue.
      *
@@ -71,6 +82,16 @@ public:
         return queue_manager_->task_count();
     }
 
+    /**
+     * @brief Retrieves the largest task id in use, including queued records recovered from disk.
+     *
+     * @return int The largest id, or 0 if there are no tasks.
+     */
+    [[nodiscard]] inline int max_task_id()
+    {
+        return queue_manager_->max_task_id();
+    }
+
     /**
      * @brief Sets a new time quantum for task execution.
      *
@@ -78,11 +99,21 @@ public:
      */
     void set_time_quantum(std::chrono::milliseconds);
 
+    /**
+     * @brief Retrieves how many tasks with a deadline met it, missed it or were rejected.
+     *
+     * @return DeadlineStatistics The counters of the task processor.
+     */
+    [[nodiscard]] inline DeadlineStatistics get_deadline_statistics() const noexcept
+    {
+        return processor_->deadline_statistics();
+    }
+
 private:
     std::shared_ptr<TaskQueueManager> queue_manager_;
     std::shared_ptr<TaskProcessor> processor_;
     std::shared_ptr<SchedulingAlgorithm> current_algorithm_;
-    std::shared_ptr<PosixSharedMemory> shm_;
+    std::shared_ptr<SharedMemory> shm_;
     std::atomic<bool> running_;
     std::thread scheduler_thread_;
     std::shared_ptr<Logger> logger_;
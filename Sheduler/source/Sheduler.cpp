@@ -2,14 +2,14 @@
 
 void Scheduler::start() 
 {
-    logger_->log("Starting scheduler...");
+    LOG_INFO(logger_, "Starting scheduler...");
     shm_->set_scheduler_running(true);
     running_ = true;
-    logger_->log("Starting task processor...");
+    LOG_INFO(logger_, "Starting task processor...");
 
     processor_->start();
 
-    logger_->log("Starting scheduler thread...");
+    LOG_INFO(logger_, "Starting scheduler thread...");
     scheduler_thread_ = std::thread(&Scheduler::schedule, this);
 }
 
@@ -26,6 +26,7 @@ void Scheduler::stop()
 void Scheduler::set_algorithm(std::unique_ptr<SchedulingAlgorithm> algorithm) 
 {
     current_algorithm_ = std::move(algorithm);
+    processor_->set_algorithm(current_algorithm_);
 }
 
 void Scheduler::add_task(std::shared_ptr<GeneralTask> task) 
@@ -34,6 +35,14 @@ void Scheduler::add_task(std::shared_ptr<GeneralTask> task)
     queue_manager_->reorder_tasks(current_algorithm_);
 }
 
+void Scheduler::add_tasks(const std::vector<std::shared_ptr<GeneralTask>>& tasks) 
+{
+    if (tasks.empty())
+        return;
+    queue_manager_->add_tasks(tasks);
+    queue_manager_->reorder_tasks(current_algorithm_);
+}
+
 void Scheduler::set_time_quantum(std::chrono::milliseconds quantum) 
 {
     processor_->set_time_quantum(quantum);
@@ -51,7 +60,7 @@ void Scheduler::schedule()
         } 
         catch (const std::exception& e) 
         {
-            logger_->log(std::string(e.what()));
+            LOG_ERROR(logger_, std::string(e.what()));
         }
     }
 }
\ No newline at end of file
@@ -1,8 +1,24 @@
 #pragma once
 
 #include <Task/Task.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
 #include <vector>
 
+/**
+ * @class SchedulingAlgorithm
+ * @brief Interface of the scheduling policies.
+ *
+ * A policy either reorders the shared queue through update_task_priority(), called by
+ * TaskQueueManager::reorder_tasks, which then sorts the queue by priority if
+ * orders_by_priority() is set, or keeps its own run queue (has_run_queue()): the
+ * TaskProcessor then moves every task arriving in the shared queue into the policy with
+ * enqueue(), runs the task returned by pick_next() for time_slice() and reports the run
+ * with task_ran() before enqueueing the task again. A task arriving in the shared queue
+ * that admit() refuses is dropped instead.
+ */
 class SchedulingAlgorithm 
 {
 public:
@@ -25,4 +41,71 @@ public:
      * @brief Returns algorithm name
      */
     virtual std::string get_name() const = 0;
+
+    /**
+     * @brief Tells whether the shared queue is sorted by descending priority when it is reordered.
+     */
+    [[nodiscard]] virtual bool orders_by_priority() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief Tells whether the algorithm dispatches runnable tasks from its own run queue.
+     */
+    [[nodiscard]] virtual bool has_run_queue() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief Decides whether a task arriving in the shared queue is accepted into the run queue.
+     * @param task The arriving task
+     * @return False to reject the task
+     */
+    virtual bool admit(const GeneralTask&)
+    {
+        return true;
+    }
+
+    /**
+     * @brief Adds a runnable task to the run queue.
+     * @param task The task, new or preempted
+     */
+    virtual void enqueue(std::shared_ptr<GeneralTask>) {}
+
+    /**
+     * @brief Removes the next task to run from the run queue.
+     * @return The task, or nullptr if the run queue is empty
+     */
+    virtual std::shared_ptr<GeneralTask> pick_next()
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns how long a picked task may run before it is preempted
+     * @param task The task returned by pick_next()
+     * @param quantum The time quantum of the processor
+     */
+    virtual std::chrono::milliseconds time_slice(const GeneralTask&, std::chrono::milliseconds quantum) const
+    {
+        return quantum;
+    }
+
+    /**
+     * @brief Accounts a run of a picked task
+     * @param task The task
+     * @param ran The time the task ran
+     * @param completed Whether the task finished; a finished task is not enqueued again
+     */
+    virtual void task_ran(GeneralTask&, std::chrono::nanoseconds, bool) {}
+
+    /**
+     * @brief Returns the number of tasks in the run queue
+     */
+    [[nodiscard]] virtual size_t runnable() const noexcept
+    {
+        return 0;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Task/Task.hpp>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#define SRPT_EWMA_ALPHA 0.25
+#define SRPT_DEFAULT_PREDICTION_MS 100
+
+/**
+ * @class RuntimePredictor
+ * @brief Predicts the execution time of a task from the tasks of the same kind that completed.
+ *
+ * Tasks are grouped by type and operation, the first word of the description ("add",
+ * "mul", ...). Each group keeps an exponentially weighted moving average of the processor
+ * time its tasks needed:
+ * `estimate = SRPT_EWMA_ALPHA * observed + (1 - SRPT_EWMA_ALPHA) * estimate`.
+ */
+class RuntimePredictor
+{
+public:
+    /**
+     * @brief Constructs an empty predictor.
+     *
+     * @param alpha The weight of the newest observation, in (0, 1] (default: SRPT_EWMA_ALPHA).
+     * @throws std::invalid_argument If alpha is out of range.
+     */
+    explicit RuntimePredictor(double alpha = SRPT_EWMA_ALPHA);
+
+    /**
+     * @brief Predicts the remaining processor time of a task.
+     *
+     * A task whose length is known (a get_total_time() above zero) reports its remaining
+     * work in milliseconds through save_progress(), so a task resumed from the shared queue
+     * is predicted from where it stopped. Any other task is predicted from the average of
+     * its group, or SRPT_DEFAULT_PREDICTION_MS for a group that has no completed task yet,
+     * minus the time it already used.
+     *
+     * @param task The task.
+     * @param used The processor time the task already used (default: none).
+     * @return The predicted remaining time, never negative.
+     */
+    [[nodiscard]] std::chrono::nanoseconds predict(const GeneralTask&,
+        std::chrono::nanoseconds used = std::chrono::nanoseconds::zero()) const;
+
+    /**
+     * @brief Records the processor time a completed task needed.
+     *
+     * @param task The task.
+     * @param used The processor time of all its runs.
+     */
+    void observe(const GeneralTask&, std::chrono::nanoseconds);
+
+    /**
+     * @brief Retrieves the number of groups with an estimate.
+     */
+    [[nodiscard]] inline size_t groups() const noexcept
+    {
+        return estimates_.size();
+    }
+
+    /**
+     * @brief Builds the group of a task.
+     *
+     * @param task The task.
+     * @return std::string The type tag and the operation.
+     */
+    [[nodiscard]] static std::string group_of(const GeneralTask&);
+
+private:
+    double alpha_;
+    std::unordered_map<std::string, double> estimates_; ///< Average processor time in nanoseconds by group.
+};
\ No newline at end of file
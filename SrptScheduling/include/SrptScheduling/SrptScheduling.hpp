@@ -0,0 +1,133 @@
+#pragma once
+
+#include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
+#include <SrptScheduling/RuntimePredictor.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+static const std::string SRPT_SCHEDULING = "Shortest Remaining Processing Time";
+
+/**
+ * @class SrptScheduling
+ * @brief Implements shortest-remaining-processing-time scheduling on predicted runtimes.
+ *
+ * The runnable task with the least predicted remaining time (see RuntimePredictor) runs
+ * next: the remaining work of a task whose length is known, otherwise the average time of
+ * its kind minus the processor time it already used. Running short tasks first minimizes
+ * the mean response time. A preempted task is ordered again
+ * with its remaining time, so a task that arrives shorter takes over at the next slice.
+ *
+ * @details
+ * - **Run Queue**: Runnable tasks are kept in a binary min-heap keyed by predicted
+ *   remaining time, ties in arrival order; enqueue() and pick_next() are O(log n).
+ * - **Learning**: The processor time of each completed task, as reported to task_ran(),
+ *   updates the estimate of its type and operation. A task that outlives its prediction keeps a remaining time of
+ *   zero until it completes.
+ * - **Algorithm Name**: The name of the algorithm is returned as "Shortest Remaining Processing Time".
+ */
+class SrptScheduling : public SchedulingAlgorithm
+{
+public:
+    /**
+     * @brief Selects the task with the least predicted remaining time.
+     *
+     * @param tasks A vector of shared pointers to GeneralTask objects representing the available tasks.
+     * @return The index of the selected task in the input vector.
+     * @throws std::runtime_error if the task list is empty.
+     */
+    size_t select_next_task(const std::vector<std::shared_ptr<GeneralTask>>&) override;
+
+    /**
+     * @brief No-op implementation for updating task priority.
+     *
+     * The order of the tasks follows from their predicted remaining time.
+     *
+     * @param task A shared pointer to the GeneralTask object (unused in this implementation).
+     */
+    void update_task_priority(std::shared_ptr<GeneralTask>) override {}
+
+    /**
+     * @brief Returns the name of the scheduling algorithm.
+     *
+     * @return A string containing the name of the algorithm: "Shortest Remaining Processing Time".
+     */
+    [[nodiscard]] inline std::string get_name() const override
+    {
+        return SRPT_SCHEDULING;
+    }
+
+    [[nodiscard]] inline bool has_run_queue() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Inserts a task into the heap with its predicted remaining time.
+     *
+     * @param task The runnable task; if it is the task that ran last, its used time carries over.
+     */
+    void enqueue(std::shared_ptr<GeneralTask>) override;
+
+    /**
+     * @brief Removes the task with the least predicted remaining time.
+     *
+     * @return The task, or nullptr if no task is runnable.
+     */
+    std::shared_ptr<GeneralTask> pick_next() override;
+
+    /**
+     * @brief Adds a run to the used time of the task and teaches the predictor when it completes.
+     *
+     * A completed task is observed even if it was not returned by the last pick_next(); its
+     * used time is then the time of this run only.
+     *
+     * @param task The task returned by pick_next().
+     * @param ran The time the task ran.
+     * @param completed Whether the task finished.
+     */
+    void task_ran(GeneralTask&, std::chrono::nanoseconds, bool) override;
+
+    [[nodiscard]] inline size_t runnable() const noexcept override
+    {
+        return heap_.size();
+    }
+
+    /**
+     * @brief Retrieves the predictor of the algorithm.
+     */
+    [[nodiscard]] inline RuntimePredictor& predictor() noexcept
+    {
+        return predictor_;
+    }
+
+private:
+    /**
+     * @struct Entry
+     * @brief A task in the heap with its ordering key and the processor time it used.
+     */
+    struct Entry
+    {
+        std::chrono::nanoseconds remaining_;
+        uint64_t sequence_;
+        std::chrono::nanoseconds used_;
+        std::shared_ptr<GeneralTask> task_;
+    };
+
+    /**
+     * @brief Orders the heap so that the least remaining time, then the earliest arrival, is on top.
+     */
+    [[nodiscard]] static inline bool later(const Entry& lhs, const Entry& rhs) noexcept
+    {
+        if (lhs.remaining_ != rhs.remaining_)
+            return lhs.remaining_ > rhs.remaining_;
+        return lhs.sequence_ > rhs.sequence_;
+    }
+
+    RuntimePredictor predictor_;
+    std::vector<Entry> heap_;
+    uint64_t sequence_ = 0;
+    std::optional<int> running_;               ///< Id of the task returned by the last pick_next().
+    std::chrono::nanoseconds running_used_{0}; ///< The processor time used by the running task.
+};
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "SrptScheduling/RuntimePredictor.hpp"
+
+#include <algorithm>
+
+RuntimePredictor::RuntimePredictor(double alpha) : alpha_(alpha)
+{
+    if (!(alpha > 0.0 && alpha <= 1.0))
+        throw std::invalid_argument("EWMA weight must be in (0, 1]");
+}
+
+std::string RuntimePredictor::group_of(const GeneralTask& task)
+{
+    const auto& description = task.get_description();
+    auto operation = description.substr(0, description.find(' '));
+    return std::to_string(static_cast<int>(task.get_type())) + ' ' + operation;
+}
+
+std::chrono::nanoseconds RuntimePredictor::predict(const GeneralTask& task, std::chrono::nanoseconds used) const
+{
+    if (task.get_total_time().count() > 0)
+    {
+        TaskProgress progress;
+        task.save_progress(progress);
+        return std::chrono::milliseconds(std::max(progress.remaining_work_, 0));
+    }
+
+    auto it = estimates_.find(group_of(task));
+    std::chrono::nanoseconds estimate = std::chrono::milliseconds(SRPT_DEFAULT_PREDICTION_MS);
+    if (it != estimates_.cend())
+        estimate = std::chrono::nanoseconds(static_cast<int64_t>(it->second));
+    return std::max(estimate - used, std::chrono::nanoseconds::zero());
+}
+
+void RuntimePredictor::observe(const GeneralTask& task, std::chrono::nanoseconds used)
+{
+    auto observed = static_cast<double>(used.count());
+    auto [it, inserted] = estimates_.try_emplace(group_of(task), observed);
+    if (!inserted)
+        it->second = alpha_ * observed + (1.0 - alpha_) * it->second;
+}
\ No newline at end of file
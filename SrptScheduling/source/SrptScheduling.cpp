@@ -0,0 +1,65 @@
+#include "SrptScheduling/SrptScheduling.hpp"
+
+#include <algorithm>
+
+size_t SrptScheduling::select_next_task(const std::vector<std::shared_ptr<GeneralTask>>& tasks)
+{
+    if (tasks.empty())
+        throw std::runtime_error("No tasks available");
+
+    size_t selected = 0;
+    auto shortest = predictor_.predict(*tasks[0]);
+    for (size_t i = 1; i < tasks.size(); ++i)
+    {
+        auto predicted = predictor_.predict(*tasks[i]);
+        if (predicted < shortest)
+        {
+            shortest = predicted;
+            selected = i;
+        }
+    }
+    return selected;
+}
+
+void SrptScheduling::enqueue(std::shared_ptr<GeneralTask> task)
+{
+    std::chrono::nanoseconds used{0};
+    if (running_ == task->get_id())
+    {
+        used = running_used_;
+        running_.reset();
+    }
+
+    auto remaining = predictor_.predict(*task, used);
+    heap_.push_back(Entry{remaining, sequence_++, used, std::move(task)});
+    std::push_heap(heap_.begin(), heap_.end(), later);
+}
+
+std::shared_ptr<GeneralTask> SrptScheduling::pick_next()
+{
+    if (heap_.empty())
+        return nullptr;
+
+    std::pop_heap(heap_.begin(), heap_.end(), later);
+    Entry picked = std::move(heap_.back());
+    heap_.pop_back();
+
+    running_ = picked.task_->get_id();
+    running_used_ = picked.used_;
+    return std::move(picked.task_);
+}
+
+void SrptScheduling::task_ran(GeneralTask& task, std::chrono::nanoseconds ran, bool completed)
+{
+    bool running = running_ == task.get_id();
+    auto used = (running ? running_used_ : std::chrono::nanoseconds::zero()) + ran;
+    if (completed)
+        predictor_.observe(task, used);
+    if (!running)
+        return;
+
+    if (completed)
+        running_.reset();
+    else
+        running_used_ = used;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#define STRIDE1 (1 << 20)
+#define TICKETS_ATTRIBUTE "tickets"
+
+static const std::string STRIDE_SCHEDULING = "Stride Scheduling";
+static const std::string LOTTERY_SCHEDULING = "Lottery Scheduling";
+
+/**
+ * @enum StrideMode
+ * @brief How StrideScheduling turns tickets into CPU shares.
+ */
+enum class StrideMode
+{
+    STRIDE,  ///< Deterministic: the task with the smallest pass runs.
+    LOTTERY  ///< Randomized: a ticket is drawn and its holder runs.
+};
+
+/**
+ * @class StrideScheduling
+ * @brief Implements proportional-share scheduling where every task holds tickets.
+ *
+ * A task gets a share of the CPU equal to its share of the tickets of the runnable tasks.
+ * The tickets come from the TICKETS_ATTRIBUTE attribute (a positive int) and otherwise
+ * from the nice value: `20 - nice`, 1 to 40 tickets.
+ *
+ * @details
+ * - **Stride**: Every task has a pass that advances by `STRIDE1 / tickets` for each
+ *   millisecond it runs; the runnable task with the smallest pass runs next, ties in
+ *   arrival order. Runnable tasks are kept in a binary min-heap, enqueue() and pick_next()
+ *   are O(log n). Over any interval a task's runtime differs from its share by at most
+ *   one time slice.
+ * - **Placement**: A new task, or a task coming back after it blocked, gets at least the
+ *   global pass, the pass of the last task picked, so it cannot claim the time it spent
+ *   outside the run queue.
+ * - **Lottery**: With StrideMode::LOTTERY each pick draws one of the runnable tickets.
+ *   Shares are only met on average; the draw scans the run queue, O(n).
+ * - **Algorithm Name**: "Stride Scheduling" or "Lottery Scheduling".
+ */
+class StrideScheduling : public SchedulingAlgorithm
+{
+public:
+    /**
+     * @brief Constructs the algorithm.
+     *
+     * @param mode Stride or lottery selection (default: StrideMode::STRIDE).
+     * @param seed The seed of the lottery draws.
+     */
+    explicit StrideScheduling(StrideMode mode = StrideMode::STRIDE, uint32_t seed = std::random_device{}())
+        : mode_(mode), random_(seed) {}
+
+    /**
+     * @brief Selects the task with the smallest pass.
+     *
+     * @param tasks A vector of shared pointers to GeneralTask objects representing the available tasks.
+     * @return The index of the selected task in the input vector.
+     * @throws std::runtime_error if the task list is empty.
+     */
+    size_t select_next_task(const std::vector<std::shared_ptr<GeneralTask>>&) override;
+
+    /**
+     * @brief No-op implementation for updating task priority.
+     *
+     * The order of the tasks follows from their pass.
+     *
+     * @param task A shared pointer to the GeneralTask object (unused in this implementation).
+     */
+    void update_task_priority(std::shared_ptr<GeneralTask>) override {}
+
+    /**
+     * @brief Returns the name of the scheduling algorithm.
+     *
+     * @return A string containing "Stride Scheduling" or "Lottery Scheduling".
+     */
+    [[nodiscard]] inline std::string get_name() const override
+    {
+        return mode_ == StrideMode::STRIDE ? STRIDE_SCHEDULING : LOTTERY_SCHEDULING;
+    }
+
+    [[nodiscard]] inline bool has_run_queue() const noexcept override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Inserts a task into the run queue, moving its pass up to the global pass.
+     *
+     * @param task The runnable task.
+     */
+    void enqueue(std::shared_ptr<GeneralTask>) override;
+
+    /**
+     * @brief Removes the task with the smallest pass, or the holder of a drawn ticket.
+     *
+     * @return The task, or nullptr if no task is runnable.
+     */
+    std::shared_ptr<GeneralTask> pick_next() override;
+
+    /**
+     * @brief Advances the pass of the task by its stride for the time it ran.
+     *
+     * @param task The task.
+     * @param ran The time the task ran.
+     * @param completed Whether the task finished; its pass is forgotten then.
+     */
+    void task_ran(GeneralTask&, std::chrono::nanoseconds, bool) override;
+
+    [[nodiscard]] inline size_t runnable() const noexcept override
+    {
+        return entries_.size();
+    }
+
+    /**
+     * @brief Retrieves the number of tickets held by the runnable tasks.
+     */
+    [[nodiscard]] inline uint64_t total_tickets() const noexcept
+    {
+        return total_tickets_;
+    }
+
+    /**
+     * @brief Retrieves the tickets of a task.
+     *
+     * @param task The task.
+     * @return uint32_t The TICKETS_ATTRIBUTE attribute if it is a positive int, `20 - nice` otherwise.
+     */
+    [[nodiscard]] static uint32_t tickets_of(const GeneralTask&) noexcept;
+
+private:
+    /**
+     * @struct Entry
+     * @brief A runnable task with its pass and tickets.
+     */
+    struct Entry
+    {
+        uint64_t pass_;
+        uint64_t sequence_;
+        uint32_t tickets_;
+        std::shared_ptr<GeneralTask> task_;
+    };
+
+    /**
+     * @brief Orders the heap so that the smallest pass, then the earliest arrival, is on top.
+     */
+    [[nodiscard]] static inline bool later(const Entry& lhs, const Entry& rhs) noexcept
+    {
+        if (lhs.pass_ != rhs.pass_)
+            return lhs.pass_ > rhs.pass_;
+        return lhs.sequence_ > rhs.sequence_;
+    }
+
+    StrideMode mode_;
+    std::mt19937 random_;
+    std::vector<Entry> entries_; ///< A min-heap in stride mode, unordered in lottery mode.
+    std::unordered_map<int, uint64_t> passes_; ///< Pass of the tasks that ran, by id.
+    uint64_t global_pass_ = 0;
+    uint64_t total_tickets_ = 0;
+    uint64_t sequence_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "StrideScheduling/StrideScheduling.hpp"
+
+#include <algorithm>
+#include <any>
+
+uint32_t StrideScheduling::tickets_of(const GeneralTask& task) noexcept
+{
+    auto attribute = task.get_attribute(TICKETS_ATTRIBUTE);
+    if (auto tickets = std::any_cast<int>(&attribute); tickets && *tickets > 0)
+        return static_cast<uint32_t>(std::min(*tickets, STRIDE1));
+    return static_cast<uint32_t>(20 - std::clamp(task.get_static_priority(), -20, 19));
+}
+
+size_t StrideScheduling::select_next_task(const std::vector<std::shared_ptr<GeneralTask>>& tasks)
+{
+    if (tasks.empty())
+        throw std::runtime_error("No tasks available");
+
+    auto pass_of = [this](const GeneralTask& task)
+    {
+        auto it = passes_.find(task.get_id());
+        return it != passes_.cend() ? it->second : global_pass_;
+    };
+
+    size_t selected = 0;
+    for (size_t i = 1; i < tasks.size(); ++i)
+    {
+        if (pass_of(*tasks[i]) < pass_of(*tasks[selected]))
+            selected = i;
+    }
+    return selected;
+}
+
+void StrideScheduling::enqueue(std::shared_ptr<GeneralTask> task)
+{
+    uint32_t tickets = tickets_of(*task);
+    auto [it, inserted] = passes_.try_emplace(task->get_id(), global_pass_);
+    it->second = std::max(it->second, global_pass_);
+
+    total_tickets_ += tickets;
+    entries_.push_back(Entry{it->second, sequence_++, tickets, std::move(task)});
+    if (mode_ == StrideMode::STRIDE)
+        std::push_heap(entries_.begin(), entries_.end(), later);
+}
+
+std::shared_ptr<GeneralTask> StrideScheduling::pick_next()
+{
+    if (entries_.empty())
+        return nullptr;
+
+    if (mode_ == StrideMode::STRIDE)
+        std::pop_heap(entries_.begin(), entries_.end(), later);
+    else
+    {
+        uint64_t ticket = std::uniform_int_distribution<uint64_t>(0, total_tickets_ - 1)(random_);
+        auto winner = entries_.begin();
+        for (; ticket >= winner->tickets_; ++winner)
+            ticket -= winner->tickets_;
+        std::iter_swap(winner, entries_.end() - 1);
+    }
+
+    Entry picked = std::move(entries_.back());
+    entries_.pop_back();
+    total_tickets_ -= picked.tickets_;
+    global_pass_ = std::max(global_pass_, picked.pass_);
+    return std::move(picked.task_);
+}
+
+void StrideScheduling::task_ran(GeneralTask& task, std::chrono::nanoseconds ran, bool completed)
+{
+    if (completed)
+    {
+        passes_.erase(task.get_id());
+        return;
+    }
+
+    auto ran_us = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(ran).count(), 0);
+    uint64_t stride = STRIDE1 / tickets_of(task);
+    passes_[task.get_id()] += stride * static_cast<uint64_t>(ran_us) / 1000;
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <any>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <sys/resource.h>
@@ -13,9 +14,40 @@
 #include <algorithm>
 #include <memory>
 
-#include <Logger/Logger.hpp>
+#include <Logger/SharedLogChannel.hpp>
 
 #define STATE_DIR "state_log"
+#define DEADLINE_ATTRIBUTE "deadline"
+
+/**
+ * @brief The deadline of a task that has none.
+ */
+static constexpr std::chrono::steady_clock::time_point NO_DEADLINE = std::chrono::steady_clock::time_point::max();
+
+/**
+ * @enum TaskType
+ * @brief The tag a task class is stored with in the shared queue.
+ */
+enum class TaskType : uint8_t
+{ 
+    UNIX_TASK, 
+    CPU_INTENSIVE_TASK, 
+    IO_BOUND_TASK 
+};
+
+/**
+ * @struct TaskProgress
+ * @brief The execution state a task needs to resume exactly where it stopped.
+ *
+ * `remaining_work_` is counted in the unit of the task type: milliseconds of work for
+ * a CPU-intensive task, operations for an I/O-bound task and 0 for a plain UnixTask.
+ */
+struct TaskProgress
+{
+    int remaining_work_ = 0;
+    float virtual_runtime_ = 0.0f;
+    float cpu_usage_ = 0.0f;
+};
 
 /**
  * @class GeneralTask
@@ -103,12 +135,75 @@ public:
     /**
      * @brief Retrieves the total time required for the task to complete.
      *
-     * @return std::chrono::milliseconds The total duration of the task.
+     * @return std::chrono::milliseconds The total duration of the task, or zero if it is not known.
      */
     virtual std::chrono::milliseconds get_total_time() const noexcept = 0;
 
     virtual int get_id() const noexcept = 0;
 
+    /**
+     * @brief Retrieves the tag of the task class.
+     *
+     * @return TaskType The tag the task is stored with in the shared queue.
+     */
+    virtual TaskType get_type() const noexcept = 0;
+
+    /**
+     * @brief Saves the execution state of the task.
+     *
+     * @param progress Receives the state.
+     */
+    virtual void save_progress(TaskProgress&) const noexcept = 0;
+
+    /**
+     * @brief Restores an execution state saved by save_progress().
+     *
+     * @param progress The state to resume from.
+     */
+    virtual void restore_progress(const TaskProgress&) noexcept = 0;
+
+    /**
+     * @brief Retrieves the static (nice) priority of the task.
+     *
+     * @return int The nice value in [-20, 19].
+     */
+    virtual int get_static_priority() const noexcept = 0;
+
+    /**
+     * @brief Retrieves the virtual runtime of the task.
+     *
+     * @return float The weighted runtime in milliseconds charged by a fair scheduler.
+     */
+    virtual float get_virtual_runtime() const noexcept = 0;
+
+    /**
+     * @brief Sets the virtual runtime of the task.
+     *
+     * @param virtual_runtime The new virtual runtime in milliseconds.
+     */
+    virtual void set_virtual_runtime(float) noexcept = 0;
+
+    /**
+     * @brief Retrieves the CPU usage measured over the last run of the task.
+     *
+     * @return float The share of the last time quantum spent on the CPU, in [0, 1].
+     */
+    virtual float get_cpu_usage() const noexcept = 0;
+
+    /**
+     * @brief Retrieves the absolute deadline of the task.
+     *
+     * @return std::chrono::steady_clock::time_point The deadline, or NO_DEADLINE.
+     */
+    virtual std::chrono::steady_clock::time_point get_deadline() const noexcept = 0;
+
+    /**
+     * @brief Sets the absolute deadline of the task.
+     *
+     * @param deadline The deadline, or NO_DEADLINE to remove it.
+     */
+    virtual void set_deadline(std::chrono::steady_clock::time_point) noexcept = 0;
+
     /**
      * @brief Virtual destructor for proper cleanup of derived classes.
      */
@@ -153,6 +248,16 @@ public:
         return id_;
     }
 
+    /**
+     * @brief Retrieves the tag of the task class.
+     *
+     * @return TaskType TaskType::UNIX_TASK.
+     */
+    [[nodiscard]] inline TaskType get_type() const noexcept override
+    {
+        return TaskType::UNIX_TASK;
+    }
+
     /**
      * @brief Retrieves the task's priority.
      *
@@ -163,6 +268,66 @@ public:
         return dynamic_priority_;
     }
 
+    /**
+     * @brief Retrieves the static (nice) priority of the task.
+     *
+     * @return int The nice value in [-20, 19].
+     */
+    [[nodiscard]] inline int get_static_priority() const noexcept override
+    {
+        return static_priority_;
+    }
+
+    /**
+     * @brief Retrieves the virtual runtime of the task.
+     *
+     * @return float The weighted runtime in milliseconds charged by a fair scheduler.
+     */
+    [[nodiscard]] inline float get_virtual_runtime() const noexcept override
+    {
+        return virtual_runtime_;
+    }
+
+    /**
+     * @brief Sets the virtual runtime of the task.
+     *
+     * @param virtual_runtime The new virtual runtime in milliseconds.
+     */
+    inline void set_virtual_runtime(float virtual_runtime) noexcept override
+    {
+        virtual_runtime_ = virtual_runtime;
+    }
+
+    /**
+     * @brief Retrieves the CPU usage measured over the last run of the task.
+     *
+     * @return float The share of the last time quantum spent on the CPU, in [0, 1].
+     */
+    [[nodiscard]] inline float get_cpu_usage() const noexcept override
+    {
+        return cpu_usage_;
+    }
+
+    /**
+     * @brief Retrieves the absolute deadline of the task.
+     *
+     * @return std::chrono::steady_clock::time_point The deadline, or NO_DEADLINE.
+     */
+    [[nodiscard]] inline std::chrono::steady_clock::time_point get_deadline() const noexcept override
+    {
+        return deadline_;
+    }
+
+    /**
+     * @brief Sets the absolute deadline of the task.
+     *
+     * @param deadline The deadline, or NO_DEADLINE to remove it.
+     */
+    inline void set_deadline(std::chrono::steady_clock::time_point deadline) noexcept override
+    {
+        deadline_ = deadline;
+    }
+
     /**
      * @brief Retrieves the task's description (const version).
      *
@@ -203,9 +368,24 @@ public:
         return arrival_time_;
     }
 
+    /**
+     * @brief Retrieves the total time required for the task to complete.
+     *
+     * A generic task does not know its length in advance.
+     *
+     * @return std::chrono::milliseconds Zero, meaning unknown.
+     */
+    [[nodiscard]] inline std::chrono::milliseconds get_total_time() const noexcept override
+    {
+        return std::chrono::milliseconds::zero();
+    }
+
     /**
      * @brief Retrieves an attribute by name.
      *
+     * DEADLINE_ATTRIBUTE yields the deadline as a std::chrono::steady_clock::time_point,
+     * or an empty `std::any` if the task has none.
+     *
      * @param name The name of the attribute.
      * @return std::any The attribute value, or an empty `std::any` if not found.
      */
@@ -214,8 +394,12 @@ public:
     /**
      * @brief Sets an attribute by name.
      *
+     * DEADLINE_ATTRIBUTE sets the deadline, given either as a std::chrono::steady_clock::time_point
+     * or as std::chrono::milliseconds relative to the arrival of the task.
+     *
      * @param name The name of the attribute.
      * @param value The value to set for the attribute.
+     * @throws std::invalid_argument If a deadline is given in another type.
      */
     void set_attribute(const std::string& name, const std::any& value) override;
 
@@ -265,6 +449,20 @@ public:
      */
     bool execute(std::chrono::milliseconds) override;
 
+    /**
+     * @brief Saves the virtual runtime and CPU usage of the task.
+     *
+     * @param progress Receives the state; `remaining_work_` is set to 0.
+     */
+    void save_progress(TaskProgress&) const noexcept override;
+
+    /**
+     * @brief Restores the virtual runtime and CPU usage of the task.
+     *
+     * @param progress The state to resume from.
+     */
+    void restore_progress(const TaskProgress&) noexcept override;
+
     /**
      * @brief Launches a process for the task.
      *
@@ -275,16 +473,6 @@ public:
      * @throws std::runtime_error If the process cannot be forked.
      */
     [[nodiscard]] pid_t launch_process(const std::string&);
-private:
-
-     /**
-     * @brief Converts a `TaskState` enum to its string representation.
-     *
-     * @param state The task state to convert.
-     * @return std::string The string representation of the task state.
-     */
-    std::string task_state_to_string(TaskState);
-
 protected:
 
     /**
@@ -307,8 +495,6 @@ protected:
      */
     [[nodiscard]] bool check_process_status() const noexcept;
 
-    [[maybe_unused]] inline std::chrono::milliseconds get_total_time() const noexcept override {}
-
 protected:
     const int id_;
 
@@ -331,6 +517,7 @@ protected:
     std::chrono::steady_clock::time_point last_execution_time_;
     float cpu_usage_ = 0.0f;        ///< CPU usage of the task.
     float virtual_runtime_ = 0.0f; ///< Virtual runtime of the task
+    std::chrono::steady_clock::time_point deadline_ = NO_DEADLINE; ///< Absolute deadline of the task.
     bool is_io_bound_ = false;    ///< Indicates whether the task is I/O bound.
 
     /**
@@ -345,6 +532,4 @@ protected:
     };
 
     SchedulingParams scheduling_params_;
-
-    std::shared_ptr<Logger> logger_;
 };
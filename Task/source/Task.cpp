@@ -1,15 +1,30 @@
 #include "Task/Task.hpp"
 
+namespace
+{
+    /**
+     * @brief Gets the state logger shared by all tasks of the process, created on first use.
+     */
+    const std::shared_ptr<Logger>& state_logger()
+    {
+        static const std::shared_ptr<Logger> logger =
+            std::make_shared<SharedLogger>(LOGS_DIR, STATE_DIR, OverflowPolicy::COUNT, STATE_LOG_FORMAT);
+        return logger;
+    }
+}
+
 UnixTask::UnixTask(int id, std::string desc, int static_prio) : id_(id), description_(std::move(desc)),
                             arrival_time_(std::chrono::steady_clock::now()),
                             static_priority_(static_prio), dynamic_priority_(static_prio) 
 {
-    logger_ = std::make_shared<FileLogger>(LOGS_DIR, STATE_DIR);
     validate_priority();
 }
 
 [[nodiscard]] std::any UnixTask::get_attribute(const std::string &name) const noexcept 
 {
+    if (name == DEADLINE_ATTRIBUTE)
+        return deadline_ == NO_DEADLINE ? std::any{} : std::any{deadline_};
+
     auto it = attributes_.find(name);
     if (it != attributes_.cend()) 
         return it->second;
@@ -18,17 +33,23 @@ UnixTask::UnixTask(int id, std::string desc, int static_prio) : id_(id), descrip
 
 void UnixTask::set_attribute(const std::string &name, const std::any &value)
 {
+    if (name == DEADLINE_ATTRIBUTE)
+    {
+        if (auto deadline = std::any_cast<std::chrono::steady_clock::time_point>(&value))
+            deadline_ = *deadline;
+        else if (auto budget = std::any_cast<std::chrono::milliseconds>(&value))
+            deadline_ = arrival_time_ + *budget;
+        else
+            throw std::invalid_argument("Deadline must be a time point or a duration in milliseconds");
+        return;
+    }
     attributes_[name] = value;
 }
 
 void UnixTask::set_state(TaskState state) 
 {
-    if (logger_) 
-    {
-        logger_->log("Task " + std::to_string(id_) + " changed state from " +
-                    task_state_to_string(state_) + " to " +
-                    task_state_to_string(state));
-    }
+    LOG_TRACE_EVENT(state_logger(), "Task {} changed state from {READY|RUNNING|WAITING|COMPLETED} to "
+        "{READY|RUNNING|WAITING|COMPLETED}", id_, state_, state);
     if(state == TaskState::COMPLETED)
         completed_ = true;
     state_ = state; 
@@ -68,21 +89,17 @@ bool UnixTask::execute(std::chrono::milliseconds)
     throw std::runtime_error("Execute method not implemented");
 }
 
-std::string UnixTask::task_state_to_string(TaskState state) 
+void UnixTask::save_progress(TaskProgress& progress) const noexcept
 {
-    switch (state) 
-    {
-        case TaskState::READY:
-            return "READY";
-        case TaskState::RUNNING:
-            return "RUNNING";
-        case TaskState::WAITING:
-            return "WAITING";
-        case TaskState::COMPLETED:
-            return "COMPLETED";
-        default:
-            return "UNKNOWN";
-    }
+    progress.remaining_work_ = 0;
+    progress.virtual_runtime_ = virtual_runtime_;
+    progress.cpu_usage_ = cpu_usage_;
+}
+
+void UnixTask::restore_progress(const TaskProgress& progress) noexcept
+{
+    virtual_runtime_ = progress.virtual_runtime_;
+    cpu_usage_ = progress.cpu_usage_;
 }
 
 void UnixTask::adjust_dynamic_priority()
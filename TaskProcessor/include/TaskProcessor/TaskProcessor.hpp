@@ -1,13 +1,27 @@
 #pragma once
 
 #include <TaskQueueManager/TaskQueueManager.hpp>
-#include <Logger/Logger.hpp>
+#include <Logger/SharedLogChannel.hpp>
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #define STATE_DIR "state_processor"
+#define WAIT_TIMEOUT_MS 100
+
+/**
+ * @struct DeadlineStatistics
+ * @brief Outcome of the tasks with a deadline handled by a processor.
+ */
+struct DeadlineStatistics
+{
+    uint64_t met_;      ///< Tasks completed by their deadline.
+    uint64_t missed_;   ///< Tasks completed after their deadline.
+    uint64_t rejected_; ///< Tasks refused by the admission test of the algorithm.
+};
 
 /**
  * @class TaskProcessor
@@ -16,6 +30,14 @@
  * This class retrieves tasks from the TaskQueueManager, executes them within a
  * specified time quantum, and re-adds incomplete tasks back to the queue. It
  * also provides methods to start, stop, and adjust the time quantum.
+ *
+ * With a SchedulingAlgorithm that keeps a run queue, the shared queue only delivers
+ * new tasks: they are moved into the algorithm, which picks the task to run and its
+ * time slice, and preempted tasks go back to the algorithm instead of the shared queue.
+ * The run queue, including a task preempted as the processor stops, is returned to the
+ * shared queue when the processor stops. A new task that the algorithm does not admit
+ * is released without running. Completed tasks are counted against their deadline
+ * whatever the algorithm.
  */
 class TaskProcessor final
 {
@@ -28,7 +50,7 @@ public:
      */
     TaskProcessor(std::shared_ptr<TaskQueueManager> queue_manager, std::chrono::milliseconds time_quantum)
         :queue_manager_(queue_manager), time_quantum_(time_quantum), running_(false),
-        logger_(std::make_shared<FileLogger>(LOGS_DIR, STATE_DIR)) {}
+        logger_(std::make_shared<SharedLogger>(LOGS_DIR, STATE_DIR, OverflowPolicy::COUNT, STATE_LOG_FORMAT)) {}
     
     /**
      * @brief Starts the task processing thread.
@@ -51,6 +73,17 @@ public:
      */
     void set_time_quantum(std::chrono::milliseconds);
 
+    /**
+     * @brief Sets the scheduling algorithm that dispatches tasks.
+     *
+     * Takes effect before the next task is picked. Tasks in the run queue of the previous
+     * algorithm move to the new one, or back to the shared queue if the new algorithm
+     * has no run queue.
+     *
+     * @param algorithm The algorithm, or nullptr to run tasks in shared queue order.
+     */
+    void set_algorithm(std::shared_ptr<SchedulingAlgorithm>);
+
     /**
      * @brief Checks if the TaskProcessor is currently running.
      *
@@ -71,6 +104,17 @@ public:
         return queue_manager_;
     }
 
+    /**
+     * @brief Retrieves how many tasks with a deadline met it, missed it or were rejected.
+     *
+     * @return DeadlineStatistics The counters since the processor was constructed.
+     */
+    [[nodiscard]] inline DeadlineStatistics deadline_statistics() const noexcept
+    {
+        return DeadlineStatistics{deadlines_met_.load(std::memory_order_relaxed),
+            deadlines_missed_.load(std::memory_order_relaxed), tasks_rejected_.load(std::memory_order_relaxed)};
+    }
+
 private:
     std::shared_ptr<TaskQueueManager> queue_manager_;
     std::chrono::milliseconds time_quantum_;
@@ -78,12 +122,55 @@ private:
     std::thread processor_thread_;
     std::shared_ptr<Logger> logger_;
 
+    std::shared_ptr<SchedulingAlgorithm> algorithm_; ///< Used by the processing thread only.
+    std::shared_ptr<SchedulingAlgorithm> pending_algorithm_;
+    std::atomic<bool> algorithm_changed_{false};
+    std::mutex algorithm_mutex_;
+
+    std::atomic<uint64_t> deadlines_met_{0};
+    std::atomic<uint64_t> deadlines_missed_{0};
+    std::atomic<uint64_t> tasks_rejected_{0};
+
+    /**
+     * @brief Retrieves the next task to run, waiting at most WAIT_TIMEOUT_MS for one.
+     *
+     * @return The task, or nullptr if none arrived.
+     */
+    std::shared_ptr<GeneralTask> next_task();
+
+    /**
+     * @brief Moves a new task into the run queue, or releases it if the algorithm rejects it.
+     *
+     * @param task The task delivered by the shared queue.
+     */
+    void admit(std::shared_ptr<GeneralTask>);
+
+    /**
+     * @brief Counts a completed task as having met or missed its deadline.
+     *
+     * @param task The task; tasks without a deadline are not counted.
+     */
+    void task_completed(const std::shared_ptr<GeneralTask>&);
+
+    /**
+     * @brief Installs the algorithm passed to set_algorithm(), moving the run queue over.
+     */
+    void switch_algorithm();
+
+    /**
+     * @brief Empties the run queue of the current algorithm.
+     *
+     * @return The tasks that were runnable.
+     */
+    std::vector<std::shared_ptr<GeneralTask>> take_run_queue();
+
     /**
      * @brief Processes tasks in a loop.
      *
      * Continuously retrieves tasks from the queue, executes them within the
      * time quantum, and handles incomplete tasks by re-adding them to the
-     * queue.
+     * queue. While the queue is empty the thread sleeps on the queue itself
+     * and re-checks the running flag every WAIT_TIMEOUT_MS milliseconds.
      */
     void process_tasks();
 };
\ No newline at end of file
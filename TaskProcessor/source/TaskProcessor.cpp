@@ -18,37 +18,143 @@ void TaskProcessor::set_time_quantum(std::chrono::milliseconds quantum)
     time_quantum_ = quantum;
 }
 
+void TaskProcessor::set_algorithm(std::shared_ptr<SchedulingAlgorithm> algorithm) 
+{
+    std::lock_guard<std::mutex> lock(algorithm_mutex_);
+    pending_algorithm_ = std::move(algorithm);
+    algorithm_changed_.store(true, std::memory_order_release);
+}
+
+void TaskProcessor::switch_algorithm() 
+{
+    if (!algorithm_changed_.load(std::memory_order_acquire))
+        return;
+
+    std::shared_ptr<SchedulingAlgorithm> next;
+    {
+        std::lock_guard<std::mutex> lock(algorithm_mutex_);
+        next = std::move(pending_algorithm_);
+        algorithm_changed_.store(false, std::memory_order_relaxed);
+    }
+
+    auto tasks = take_run_queue();
+    algorithm_ = std::move(next);
+    if (algorithm_ && algorithm_->has_run_queue())
+    {
+        for (auto& task : tasks)
+            algorithm_->enqueue(task);
+    }
+    else if (!tasks.empty())
+        queue_manager_->add_tasks(tasks);
+}
+
+std::vector<std::shared_ptr<GeneralTask>> TaskProcessor::take_run_queue() 
+{
+    std::vector<std::shared_ptr<GeneralTask>> tasks;
+    if (!algorithm_ || !algorithm_->has_run_queue())
+        return tasks;
+
+    while (auto task = algorithm_->pick_next())
+        tasks.push_back(std::move(task));
+    return tasks;
+}
+
+std::shared_ptr<GeneralTask> TaskProcessor::next_task() 
+{
+    if (!algorithm_ || !algorithm_->has_run_queue())
+        return queue_manager_->get_next_task_for(std::chrono::milliseconds(WAIT_TIMEOUT_MS));
+
+    for (auto& task : queue_manager_->take_tasks())
+        admit(task);
+
+    if (algorithm_->runnable() == 0)
+    {
+        auto task = queue_manager_->get_next_task_for(std::chrono::milliseconds(WAIT_TIMEOUT_MS));
+        if (!task)
+            return nullptr;
+        admit(task);
+    }
+    return algorithm_->pick_next();
+}
+
+void TaskProcessor::admit(std::shared_ptr<GeneralTask> task) 
+{
+    if (algorithm_->admit(*task))
+    {
+        algorithm_->enqueue(std::move(task));
+        return;
+    }
+
+    tasks_rejected_.fetch_add(1, std::memory_order_relaxed);
+    queue_manager_->release_task(task);
+    LOG_WARN(logger_, "Task rejected by admission test: " + task->get_description());
+}
+
+void TaskProcessor::task_completed(const std::shared_ptr<GeneralTask>& task) 
+{
+    auto deadline = task->get_deadline();
+    if (deadline == NO_DEADLINE)
+        return;
+
+    if (std::chrono::steady_clock::now() <= deadline)
+        deadlines_met_.fetch_add(1, std::memory_order_relaxed);
+    else
+    {
+        deadlines_missed_.fetch_add(1, std::memory_order_relaxed);
+        LOG_WARN(logger_, "Task missed its deadline: " + task->get_description());
+    }
+}
+
 void TaskProcessor::process_tasks() 
 {
     while (running_) 
     {
+        std::shared_ptr<GeneralTask> task;
         try 
         {
-            if (queue_manager_->task_count() > 0) 
+            switch_algorithm();
+            task = next_task();
+            if (!task)
+                continue;
+
+            LOG_DEBUG(logger_, "Processing task: " + task->get_description());
+            bool dispatching = algorithm_ && algorithm_->has_run_queue();
+            auto slice = dispatching ? algorithm_->time_slice(*task, time_quantum_) : time_quantum_;
+            auto start = std::chrono::steady_clock::now();
+
+            bool completed = true;
+            auto total_time = task->get_total_time();
+            if (total_time.count() > 0 && total_time < slice)
+                task->execute(total_time);
+            else
+                completed = task->execute(slice);
+
+            if (dispatching)
+                algorithm_->task_ran(*task, std::chrono::steady_clock::now() - start, completed);
+
+            if (!completed)
             {
-                auto task = queue_manager_->get_next_task();
-                logger_->log("Processing task: " + task->get_description());
-                if(task->get_total_time().count() < time_quantum_.count())
-                {
-                    task->execute(task->get_total_time());
-                    logger_->log("Task completed: " + task->get_description());
-                    continue;
-                }
+                if (dispatching)
+                    algorithm_->enqueue(task);
                 else
-                {
-                    bool completed = task->execute(time_quantum_);
-                    if (!completed && running_)
-                        queue_manager_->add_task(task);
-                    else
-                        logger_->log("Task completed: " + task->get_description());
-                }
-            } 
-            else 
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    queue_manager_->add_task(task);
+            }
+            else
+            {
+                task_completed(task);
+                queue_manager_->release_task(task);
+                LOG_INFO(logger_, "Task completed: " + task->get_description());
+            }
         } 
         catch (const std::exception &e) 
         {
-            logger_->log("Error processing task: " + std::string(e.what()));
+            if (task)
+                queue_manager_->release_task(task);
+            LOG_ERROR(logger_, "Error processing task: " + std::string(e.what()));
         }
     }
+
+    auto tasks = take_run_queue();
+    if (!tasks.empty())
+        queue_manager_->add_tasks(tasks);
 }
\ No newline at end of file
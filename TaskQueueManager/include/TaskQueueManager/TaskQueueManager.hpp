@@ -2,6 +2,8 @@
 
 #include <Task/Task.hpp>
 #include <PosixSharedMemory/PosixSharedMemory.hpp>
+#include <TaskQueueManager/TaskRegistry.hpp>
+#include <TaskQueueManager/TaskTypes.hpp>
 #include <ShedulerAlgorithm/ShedulerAlgorithm.hpp>
 #include <Tasks/Tasks.hpp>
 
@@ -12,6 +14,12 @@
  * The TaskQueueManager class is responsible for adding tasks to the queue,
  * retrieving the next task, reordering tasks using a scheduling algorithm, and
  * converting between shared tasks and general tasks.
+ *
+ * Tasks added through the manager are kept in a TaskRegistry, so a dequeued
+ * record resolves to the same task object, with its scheduling history, instead
+ * of a new one. Only records enqueued by other processes are turned into new
+ * objects, which are registered from then on. A task whose id is taken by another
+ * live task is refused with an exception instead of being resolved to the wrong object.
  */
 class TaskQueueManager final
 {
@@ -24,12 +32,12 @@ public:
     explicit TaskQueueManager(PosixSharedMemory& shm) : shared_memory_(std::make_shared<PosixSharedMemory>(shm)) {}
 
     /**
-     * @brief Constructs a TaskQueueManager with a shared pointer to
-     * PosixSharedMemory.
+     * @brief Constructs a TaskQueueManager with a shared pointer to a
+     * SharedMemory implementation.
      *
-     * @param shm Shared pointer to the PosixSharedMemory object.
+     * @param shm Shared pointer to the SharedMemory object.
      */
-    explicit TaskQueueManager(std::shared_ptr<PosixSharedMemory> shm): shared_memory_(shm) {}
+    explicit TaskQueueManager(std::shared_ptr<SharedMemory> shm): shared_memory_(shm) {}
 
     /**
      * @brief Adds a task to the shared memory queue.
@@ -37,18 +45,83 @@ public:
      * Converts the GeneralTask to a SharedTask and enqueues it into the shared memory.
      *
      * @param task Shared pointer to the GeneralTask to be added.
+     * @throws std::invalid_argument If another live task has the same id; nothing is enqueued.
      */
     void add_task(std::shared_ptr<GeneralTask>);
 
+    /**
+     * @brief Adds a batch of tasks to the shared memory queue.
+     *
+     * Converts every GeneralTask to a SharedTask and enqueues them with a single
+     * bulk operation.
+     *
+     * @param tasks The tasks to be added, in order.
+     * @throws std::invalid_argument If the id of a task is taken by another live task;
+     * nothing is enqueued.
+     */
+    void add_tasks(const std::vector<std::shared_ptr<GeneralTask>>&);
+
     /**
      * @brief Retrieves the next task from the shared memory queue.
      *
-     * Dequeues a SharedTask from the shared memory and converts it back to a GeneralTask.
+     * Dequeues a SharedTask from the shared memory and looks up its task object,
+     * converting the record into a new GeneralTask only if the task is not registered.
      *
      * @return Shared pointer to the retrieved GeneralTask.
      */
     std::shared_ptr<GeneralTask> get_next_task();
 
+    /**
+     * @brief Retrieves the next task, waiting at most for the given timeout.
+     *
+     * Blocks on the shared memory queue itself, so a task enqueued by any
+     * process is picked up as soon as it arrives.
+     *
+     * @param timeout The maximum time to wait for a task.
+     * @return Shared pointer to the retrieved GeneralTask, or nullptr if the timeout expired.
+     */
+    std::shared_ptr<GeneralTask> get_next_task_for(std::chrono::milliseconds);
+
+    /**
+     * @brief Finds the largest task id in use.
+     *
+     * Covers the registered tasks and every record in the queue, including records
+     * recovered from a persistent segment. Processes that create tasks start their id
+     * counter above it, so new tasks never take the id of a queued one.
+     *
+     * @return The largest id, or 0 if there are no tasks.
+     */
+    [[nodiscard]] int max_task_id();
+
+    /**
+     * @brief Removes every task currently in the queue without waiting.
+     *
+     * @return The tasks, in queue order.
+     */
+    std::vector<std::shared_ptr<GeneralTask>> take_tasks();
+
+    /**
+     * @brief Drops a finished task from the registry.
+     *
+     * Must be called when a task retrieved from the queue is not added again.
+     *
+     * @param task The finished task.
+     */
+    inline void release_task(const std::shared_ptr<GeneralTask>& task)
+    {
+        registry_.release(task);
+    }
+
+    /**
+     * @brief Retrieves the number of live task objects kept by the manager.
+     *
+     * @return size_t The number of registered tasks, queued or running.
+     */
+    [[nodiscard]] inline size_t registered_count() const
+    {
+        return registry_.size();
+    }
+
     /**
      * @brief Retrieves the current number of tasks in the queue.
      *
@@ -62,16 +135,32 @@ public:
     /**
      * @brief Reorders tasks in the queue based on a scheduling algorithm.
      *
-     * Removes all tasks from the queue, updates their priorities using the
-     * provided scheduling algorithm, and re-adds them to the queue.
+     * Removes all tasks from the queue in one bulk operation, updates their
+     * priorities using the provided scheduling algorithm, and re-adds them to
+     * the queue in one bulk operation, highest priority first if the algorithm
+     * orders by priority and in their previous order otherwise. Does nothing if the shared memory keeps
+     * tasks in priority order by itself or if the algorithm orders tasks in its
+     * own run queue.
      *
      * @param algorithm Shared pointer to the SchedulingAlgorithm used for
      * reordering.
      */
     void reorder_tasks(std::shared_ptr<SchedulingAlgorithm>);
 
+    /**
+     * @brief Prints the queued tasks to standard output for debugging.
+     *
+     * Never called on the enqueue path; the shared memory formats a snapshot
+     * after releasing its lock.
+     */
+    inline void print_tasks() const
+    {
+        shared_memory_->print();
+    }
+
 private:
-    std::shared_ptr<PosixSharedMemory> shared_memory_;
+    std::shared_ptr<SharedMemory> shared_memory_;
+    TaskRegistry registry_;
     
 private:
     /**
@@ -84,10 +173,19 @@ private:
      */
     void convert_to_shared_task(std::shared_ptr<GeneralTask>, SharedTask&);
     
+    /**
+     * @brief Resolves a dequeued SharedTask to its task object.
+     *
+     * @param src Reference to the dequeued SharedTask.
+     * @return The registered task, or a new registered task converted from the record.
+     * @throws std::runtime_error If the id of the record is registered with another type.
+     */
+    std::shared_ptr<GeneralTask> resolve(const SharedTask&);
+
     /**
      * @brief Converts a SharedTask back to a GeneralTask.
      *
-     * Creates a GeneralTask object (or its derived type) from the SharedTask.
+     * Creates an object of the class registered in TaskTypes for the record's tag.
      *
      * @param src Reference to the source SharedTask.
      * @return Shared pointer to the converted GeneralTask.
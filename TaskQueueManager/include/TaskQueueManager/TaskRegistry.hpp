@@ -0,0 +1,74 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+#include <Task/Task.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @class TaskRegistry
+ * @brief Keeps the live task objects of one process, keyed by task id.
+ *
+ * The shared queue only carries the SharedTask record of a task; the process that
+ * owns the task keeps the object here and gets the same object back when the record
+ * is dequeued, with its execution history intact. Lookups do not allocate.
+ *
+ * Task ids must be unique among live tasks. If a second object is added under the
+ * id of a live one, the registry keeps the first and add() reports the conflict, which
+ * the TaskQueueManager turns into an error.
+ */
+class TaskRegistry final
+{
+public:
+
+    /**
+     * @brief Registers a task unless its id is already taken.
+     *
+     * @param task The task.
+     * @param type The type the task is stored with in the shared queue.
+     * @return True if `task` is the registered object for its id.
+     */
+    bool add(const std::shared_ptr<GeneralTask>&, TaskType);
+
+    /**
+     * @brief Finds the live task of a dequeued record.
+     *
+     * @param task The record.
+     * @return The registered object, or nullptr if none has the id and type of the record.
+     */
+    [[nodiscard]] std::shared_ptr<GeneralTask> find(const SharedTask&) const;
+
+    /**
+     * @brief Drops a finished task.
+     *
+     * @param task The task; nothing happens if another object is registered under its id.
+     */
+    void release(const std::shared_ptr<GeneralTask>&);
+
+    /**
+     * @brief Gets the number of registered tasks.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Gets the largest registered id, or 0 if no task is registered.
+     */
+    [[nodiscard]] int max_id() const;
+
+private:
+
+    /**
+     * @struct Entry
+     * @brief A registered task and the type it is stored with.
+     */
+    struct Entry
+    {
+        std::shared_ptr<GeneralTask> task_;
+        TaskType type_;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<int, Entry> tasks_;
+};
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <SharedMemory/SharedMemory.hpp>
+#include <Task/Task.hpp>
+#include <Tasks/Tasks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @struct TaskTypeTraits
+ * @brief Tells the task type registry how to build a task class from a shared record.
+ *
+ * A specialization names the tag of the class in `TYPE` and creates a task from the
+ * record fields its constructor takes. Priority, progress and state are restored
+ * afterwards through the GeneralTask interface, so `construct` only has to pick the
+ * class and its constructor arguments.
+ */
+template <typename Task>
+struct TaskTypeTraits;
+
+template <>
+struct TaskTypeTraits<UnixTask>
+{
+    static constexpr TaskType TYPE = TaskType::UNIX_TASK;
+
+    static std::shared_ptr<UnixTask> construct(const SharedTask& record)
+    {
+        return std::make_shared<UnixTask>(record.id_, record.description_);
+    }
+};
+
+template <>
+struct TaskTypeTraits<CpuIntensiveTask>
+{
+    static constexpr TaskType TYPE = TaskType::CPU_INTENSIVE_TASK;
+
+    static std::shared_ptr<CpuIntensiveTask> construct(const SharedTask& record)
+    {
+        return std::make_shared<CpuIntensiveTask>(record.id_, std::chrono::milliseconds(record.progress_.remaining_work_));
+    }
+};
+
+template <>
+struct TaskTypeTraits<IoBoundTask>
+{
+    static constexpr TaskType TYPE = TaskType::IO_BOUND_TASK;
+
+    static std::shared_ptr<IoBoundTask> construct(const SharedTask& record)
+    {
+        return std::make_shared<IoBoundTask>(record.id_, IoBoundTask::file_from_description(record.description_),
+            record.progress_.remaining_work_);
+    }
+};
+
+/**
+ * @class TaskTypeList
+ * @brief A compile-time registry of task classes, indexed by their TaskType tag.
+ *
+ * The table of constructors is built at compile time, so building a task from a record
+ * is one bounds check and one indirect call whatever the number of registered classes.
+ * The tag of a live task comes from GeneralTask::get_type(). A record whose tag has no
+ * registered class is built as `Default`.
+ *
+ * Registering a class takes a TaskTypeTraits specialization and an entry in the list;
+ * two classes with the same tag are rejected at compile time.
+ */
+template <typename Default, typename... Tasks>
+class TaskTypeList final
+{
+public:
+    using Constructor = std::shared_ptr<UnixTask> (*)(const SharedTask&);
+
+    /**
+     * @brief Creates a task of the class registered for the tag of a record.
+     *
+     * @param record The record.
+     * @return The new task, built from the constructor arguments of the record only.
+     */
+    [[nodiscard]] static std::shared_ptr<UnixTask> construct(const SharedTask& record)
+    {
+        auto index = static_cast<size_t>(record.type_);
+        return TABLE[index < TABLE.size() ? index : static_cast<size_t>(TaskTypeTraits<Default>::TYPE)](record);
+    }
+
+    /**
+     * @brief Checks whether a class is registered for a tag.
+     */
+    [[nodiscard]] static constexpr bool contains(TaskType type) noexcept
+    {
+        return ((TaskTypeTraits<Default>::TYPE == type) || ... || (TaskTypeTraits<Tasks>::TYPE == type));
+    }
+
+private:
+    template <typename Task>
+    static std::shared_ptr<UnixTask> make(const SharedTask& record)
+    {
+        return TaskTypeTraits<Task>::construct(record);
+    }
+
+    static constexpr size_t TABLE_SIZE = std::max({static_cast<size_t>(TaskTypeTraits<Default>::TYPE),
+        static_cast<size_t>(TaskTypeTraits<Tasks>::TYPE)...}) + 1;
+
+    static constexpr std::array<Constructor, TABLE_SIZE> make_table()
+    {
+        std::array<Constructor, TABLE_SIZE> table{};
+        std::array<bool, TABLE_SIZE> registered{};
+        ([&]
+        {
+            auto index = static_cast<size_t>(TaskTypeTraits<Tasks>::TYPE);
+            if (registered[index])
+                throw "two task classes are registered with the same tag";
+            registered[index] = true;
+            table[index] = &make<Tasks>;
+        }(), ...);
+
+        auto index = static_cast<size_t>(TaskTypeTraits<Default>::TYPE);
+        if (registered[index])
+            throw "two task classes are registered with the same tag";
+        for (auto& constructor : table)
+            if (!constructor)
+                constructor = &make<Default>;
+        return table;
+    }
+
+    static constexpr std::array<Constructor, TABLE_SIZE> TABLE = make_table();
+};
+
+/**
+ * @brief The task classes that can travel through the shared queue.
+ */
+using TaskTypes = TaskTypeList<UnixTask, CpuIntensiveTask, IoBoundTask>;
\ No newline at end of file
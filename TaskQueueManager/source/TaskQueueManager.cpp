@@ -1,31 +1,113 @@
 #include "TaskQueueManager/TaskQueueManager.hpp"
 
+#include <algorithm>
+
 void TaskQueueManager::reorder_tasks(std::shared_ptr<SchedulingAlgorithm> algorithm) 
 {
+    if (shared_memory_->is_priority_ordered() || algorithm->has_run_queue())
+        return;
+
+    size_t count = shared_memory_->size();
+    if (count == 0)
+        return;
+
+    std::vector<SharedTask> shared_tasks(count);
+    shared_tasks.resize(shared_memory_->try_dequeue_bulk(shared_tasks, count));
+
     std::vector<std::shared_ptr<GeneralTask>> tasks;
-        
-    while (!shared_memory_->empty()) 
-        tasks.emplace_back(get_next_task());
-        
-    for (auto& task : tasks) 
-            algorithm->update_task_priority(task);
-        
-    for (auto& task : tasks) 
-        add_task(task);
+    tasks.reserve(shared_tasks.size());
+    for (const auto& st : shared_tasks) 
+    {
+        tasks.push_back(resolve(st));
+        algorithm->update_task_priority(tasks.back());
+    }
+
+    if (algorithm->orders_by_priority())
+    {
+        std::stable_sort(tasks.begin(), tasks.end(),
+            [](const auto& a, const auto& b) { return a->get_priority() > b->get_priority(); });
+    }
+
+    for (size_t i = 0; i < tasks.size(); ++i) 
+        convert_to_shared_task(tasks[i], shared_tasks[i]);
+
+    shared_memory_->enqueue_bulk(shared_tasks);
 }
 
 void TaskQueueManager::add_task(std::shared_ptr<GeneralTask> task) 
 {
     SharedTask st;
     convert_to_shared_task(task, st);
+    if (!registry_.add(task, st.type_))
+        throw std::invalid_argument("Task id " + std::to_string(st.id_) + " is already in use");
     shared_memory_->enqueue(st);
-    shared_memory_->print();
+}
+
+void TaskQueueManager::add_tasks(const std::vector<std::shared_ptr<GeneralTask>>& tasks) 
+{
+    std::vector<SharedTask> shared_tasks(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) 
+    {
+        convert_to_shared_task(tasks[i], shared_tasks[i]);
+        if (!registry_.add(tasks[i], shared_tasks[i].type_))
+        {
+            for (size_t j = 0; j < i; ++j) 
+                registry_.release(tasks[j]);
+            throw std::invalid_argument("Task id " + std::to_string(shared_tasks[i].id_) + " is already in use");
+        }
+    }
+
+    shared_memory_->enqueue_bulk(shared_tasks);
 }
 
 std::shared_ptr<GeneralTask> TaskQueueManager::get_next_task() 
 {
     SharedTask st = shared_memory_->dequeue();
-    return convert_from_shared_task(st);
+    return resolve(st);
+}
+
+std::shared_ptr<GeneralTask> TaskQueueManager::get_next_task_for(std::chrono::milliseconds timeout) 
+{
+    auto st = shared_memory_->dequeue_for(timeout);
+    if (!st)
+        return nullptr;
+    return resolve(*st);
+}
+
+std::vector<std::shared_ptr<GeneralTask>> TaskQueueManager::take_tasks() 
+{
+    std::vector<std::shared_ptr<GeneralTask>> tasks;
+    size_t count = shared_memory_->size();
+    if (count == 0)
+        return tasks;
+
+    std::vector<SharedTask> shared_tasks(count);
+    shared_tasks.resize(shared_memory_->try_dequeue_bulk(shared_tasks, count));
+    tasks.reserve(shared_tasks.size());
+    for (const auto& st : shared_tasks) 
+        tasks.push_back(resolve(st));
+    return tasks;
+}
+
+std::shared_ptr<GeneralTask> TaskQueueManager::resolve(const SharedTask& src) 
+{
+    if (auto task = registry_.find(src))
+        return task;
+
+    auto task = convert_from_shared_task(src);
+    if (!registry_.add(task, src.type_))
+        throw std::runtime_error("Task id " + std::to_string(src.id_) + " is in use by a task of another type");
+    return task;
+}
+
+int TaskQueueManager::max_task_id() 
+{
+    int max_id = registry_.max_id();
+    shared_memory_->for_each_slot([&max_id](const TaskView& task)
+    {
+        max_id = std::max(max_id, task.id_);
+    });
+    return max_id;
 }
 
 void TaskQueueManager::convert_to_shared_task(std::shared_ptr<GeneralTask> src, SharedTask& dst) 
@@ -34,46 +116,22 @@ void TaskQueueManager::convert_to_shared_task(std::shared_ptr<GeneralTask> src,
     dst.priority_ = src->get_priority();
     strncpy(dst.description_, src->get_description().c_str(),  sizeof(dst.description_) - 1);
     dst.description_[sizeof(dst.description_) - 1] = '\0';
+    dst.type_ = src->get_type();
     dst.completed_ = src->is_completed();
-    if (dst.completed_) 
-    {
-        dst.remaining_time_ms_ = 0;
-        return;
-    }
-    if (dynamic_cast<CpuIntensiveTask*>(src.get())) 
-        dst.type_ = TaskType::CPU_INTENSIVE_TASK;
-    else if (dynamic_cast<IoBoundTask*>(src.get())) 
-        dst.type_ = TaskType::IO_BOUND_TASK;
-    else 
-        dst.type_ = TaskType::UNIX_TASK;
-    auto arrival_time = src->get_arrival_time();
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - arrival_time).count();
-    auto total_time_ms = src->get_total_time().count();
-    dst.remaining_time_ms_ = std::max(0, static_cast<int> (total_time_ms - elapsed_time_ms));
+    src->save_progress(dst.progress_);
+    auto deadline = src->get_deadline();
+    dst.deadline_ms_ = deadline == NO_DEADLINE ? NO_DEADLINE_MS :
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline.time_since_epoch()).count();
 }
 
 std::shared_ptr<GeneralTask> TaskQueueManager::convert_from_shared_task(const SharedTask& src) 
 {
-    std::shared_ptr<UnixTask> task;
-
-    switch (src.type_) 
-    {
-        case TaskType::CPU_INTENSIVE_TASK:
-            task = std::make_shared<CpuIntensiveTask>(src.id_, std::chrono::milliseconds(src.remaining_time_ms_));
-            break;
-
-        case TaskType::IO_BOUND_TASK:
-            task = std::make_shared<IoBoundTask>(src.id_, "output.txt", src.remaining_time_ms_); //just a flag
-            break;
-
-        case TaskType::UNIX_TASK:
-        default:
-            task = std::make_shared<UnixTask>(src.id_, src.description_);
-            break;
-    }
+    auto task = TaskTypes::construct(src);
 
     task->set_static_priority(src.priority_);
+    task->restore_progress(src.progress_);
+    if (src.deadline_ms_ != NO_DEADLINE_MS)
+        task->set_deadline(std::chrono::steady_clock::time_point(std::chrono::milliseconds(src.deadline_ms_)));
     if (src.completed_) 
         task->set_state(UnixTask::TaskState::COMPLETED);
 
@@ -0,0 +1,42 @@
+#include "TaskQueueManager/TaskRegistry.hpp"
+
+#include <algorithm>
+
+bool TaskRegistry::add(const std::shared_ptr<GeneralTask>& task, TaskType type)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = tasks_.try_emplace(task->get_id(), Entry{task, type});
+    return inserted || it->second.task_ == task;
+}
+
+std::shared_ptr<GeneralTask> TaskRegistry::find(const SharedTask& task) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tasks_.find(task.id_);
+    if (it == tasks_.cend() || it->second.type_ != task.type_)
+        return nullptr;
+    return it->second.task_;
+}
+
+void TaskRegistry::release(const std::shared_ptr<GeneralTask>& task)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tasks_.find(task->get_id());
+    if (it != tasks_.cend() && it->second.task_ == task)
+        tasks_.erase(it);
+}
+
+size_t TaskRegistry::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+int TaskRegistry::max_id() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    int max_id = 0;
+    for (const auto& [id, entry] : tasks_)
+        max_id = std::max(max_id, id);
+    return max_id;
+}
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <filesystem>
 #include <fstream>
 
+#define IO_DESCRIPTION_PREFIX "I/O-Bound Task: "
+#define IO_DEFAULT_FILE "output.txt"
+
 /**
  * @class CpuIntensiveTask
  * @brief Represents a CPU-intensive task.
@@ -40,6 +43,21 @@ public:
         return total_work_;
     }
 
+    [[nodiscard]] inline TaskType get_type() const noexcept override
+    {
+        return TaskType::CPU_INTENSIVE_TASK;
+    }
+
+    /**
+     * @brief Saves the remaining work in milliseconds along with the UnixTask state.
+     */
+    void save_progress(TaskProgress&) const noexcept override;
+
+    /**
+     * @brief Resumes with the saved remaining work; the total grows to cover it if needed.
+     */
+    void restore_progress(const TaskProgress&) noexcept override;
+
   private:
     std::chrono::milliseconds total_work_;
     std::chrono::milliseconds remaining_work_;
@@ -75,6 +93,29 @@ public:
      */
     bool execute(std::chrono::milliseconds quantum) override;
 
+    [[nodiscard]] inline TaskType get_type() const noexcept override
+    {
+        return TaskType::IO_BOUND_TASK;
+    }
+
+    /**
+     * @brief Saves the remaining operations along with the UnixTask state.
+     */
+    void save_progress(TaskProgress&) const noexcept override;
+
+    /**
+     * @brief Resumes with the saved number of remaining operations.
+     */
+    void restore_progress(const TaskProgress&) noexcept override;
+
+    /**
+     * @brief Recovers the file path from a description built by the constructor.
+     *
+     * @param description The task description.
+     * @return The file path, or IO_DEFAULT_FILE if the description has another form.
+     */
+    [[nodiscard]] static std::string file_from_description(const std::string&);
+
 private:
     std::filesystem::path file_path_;
     int operations_remaining_;
@@ -10,21 +10,15 @@ bool CpuIntensiveTask::execute(std::chrono::milliseconds quantum)
 {
     set_state(TaskState::RUNNING);
     auto start = std::chrono::steady_clock::now();
+    auto budget = std::min(quantum, remaining_work_);
 
     double result = 0;
-    for (size_t i = 0; i < 500000 * (quantum.count() / 10); ++i) 
+    for (size_t i = 0; i < 500000 * std::max<size_t>(1, quantum.count() / 10); ++i) 
     {
         result += std::sin(i) * std::cos(i);
 
-        auto current_time = std::chrono::steady_clock::now();
-        if (current_time - start >= quantum) 
-        {
-            auto actual_work = current_time - start;
-            remaining_work_ -= std::chrono::duration_cast<std::chrono::milliseconds>(actual_work);
-            cpu_usage_ = std::min(1.0f, static_cast<float>(actual_work.count()) / quantum.count());
-            set_state(TaskState::READY);
-            return false;               
-        }
+        if (std::chrono::steady_clock::now() - start >= budget) 
+            break;
     }
 
     auto actual_work = std::chrono::steady_clock::now() - start;
@@ -38,7 +32,20 @@ bool CpuIntensiveTask::execute(std::chrono::milliseconds quantum)
 }
     
 
-IoBoundTask::IoBoundTask(int id, const std::string &file_path, int operations): UnixTask(id, "I/O-Bound Task: " + file_path), 
+void CpuIntensiveTask::save_progress(TaskProgress& progress) const noexcept
+{
+    UnixTask::save_progress(progress);
+    progress.remaining_work_ = static_cast<int>(remaining_work_.count());
+}
+
+void CpuIntensiveTask::restore_progress(const TaskProgress& progress) noexcept
+{
+    UnixTask::restore_progress(progress);
+    remaining_work_ = std::chrono::milliseconds(progress.remaining_work_);
+    total_work_ = std::max(total_work_, remaining_work_);
+}
+
+IoBoundTask::IoBoundTask(int id, const std::string &file_path, int operations): UnixTask(id, IO_DESCRIPTION_PREFIX + file_path), 
                             file_path_(file_path), operations_remaining_(operations) 
 {
     is_io_bound_ = true;
@@ -70,4 +77,24 @@ bool IoBoundTask::execute(std::chrono::milliseconds quantum)
     bool completed = operations_remaining_ <= 0;
     set_state(completed ? TaskState::COMPLETED : TaskState::READY);
     return completed;
+}
+
+void IoBoundTask::save_progress(TaskProgress& progress) const noexcept
+{
+    UnixTask::save_progress(progress);
+    progress.remaining_work_ = operations_remaining_;
+}
+
+void IoBoundTask::restore_progress(const TaskProgress& progress) noexcept
+{
+    UnixTask::restore_progress(progress);
+    operations_remaining_ = progress.remaining_work_;
+}
+
+std::string IoBoundTask::file_from_description(const std::string& description)
+{
+    const std::string prefix = IO_DESCRIPTION_PREFIX;
+    if (description.size() > prefix.size() && description.compare(0, prefix.size(), prefix) == 0)
+        return description.substr(prefix.size());
+    return IO_DEFAULT_FILE;
 }
\ No newline at end of file
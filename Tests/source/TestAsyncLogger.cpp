@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <Logger/AsyncLogger.hpp>
+#include <Logger/SharedLogChannel.hpp>
+#include <LogDecode/LogDecoder.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class AsyncLoggerTest : public ::testing::Test 
+{
+protected:
+    void SetUp() override 
+    {
+        std::filesystem::remove_all(directory_);
+    }
+
+    size_t count_lines(const std::string& pattern, uint64_t* dropped = nullptr) const
+    {
+        std::ifstream file(directory_ + "/" + file_name_);
+        std::regex expected(pattern);
+        std::regex marker(R"(\[(\d+) log records dropped\])");
+        size_t count = 0;
+        std::smatch match;
+        for (std::string line; std::getline(file, line);) 
+        {
+            if (dropped && std::regex_match(line, match, marker))
+                *dropped += std::stoull(match[1]);
+            else if (std::regex_match(line, expected))
+                ++count;
+        }
+        return count;
+    }
+
+    const std::string directory_ = std::string(LOGS_DIR) + "/async_logger_test";
+    std::string file_name_;
+};
+
+TEST_F(AsyncLoggerTest, WritesEveryRecordOfEveryThreadWhenBlocking) 
+{
+    file_name_ = "blocking";
+    constexpr size_t THREADS = 4;
+    constexpr size_t RECORDS = 5000;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; ++t)
+        threads.emplace_back([&, t] 
+        {
+            AsyncLogger logger(directory_, file_name_, OverflowPolicy::BLOCK);
+            for (size_t i = 0; i < RECORDS; ++i)
+                logger.log("thread " + std::to_string(t) + " record " + std::to_string(i));
+        });
+    for (auto& thread : threads)
+        thread.join();
+    AsyncLogger::flush();
+
+    EXPECT_EQ(count_lines(R"(\[\d\d\.\d\d\.\d{4} \d\d:\d\d:\d\d\] thread \d record \d+)"), THREADS * RECORDS);
+}
+
+TEST_F(AsyncLoggerTest, CountsDiscardedRecords) 
+{
+    file_name_ = "counting";
+    constexpr size_t RECORDS = 20 * LOG_RING_RECORDS;
+
+    AsyncLogger logger(directory_, file_name_, OverflowPolicy::COUNT, LogFormat::ERROR);
+    for (size_t i = 0; i < RECORDS; ++i)
+        logger.log("record " + std::to_string(i));
+    AsyncLogger::flush();
+    logger.log("last");
+    AsyncLogger::flush();
+
+    uint64_t dropped = 0;
+    size_t written = count_lines(R"(\[ERROR\] record \d+)", &dropped);
+    EXPECT_EQ(written + dropped, RECORDS);
+    EXPECT_EQ(count_lines(R"(\[ERROR\] last)"), 1);
+}
+
+TEST(BinaryLogTest, RendersIntegersAndEnumerationNames) 
+{
+    const int64_t arguments[] = {7, 1, 3};
+    EXPECT_EQ(render_event("Task {} changed state from {READY|RUNNING} to {READY|RUNNING}", arguments),
+              "Task 7 changed state from RUNNING to 3");
+    EXPECT_EQ(render_event("{} and {}", std::span<const int64_t>(arguments, 1)), "7 and ?");
+}
+
+TEST_F(AsyncLoggerTest, BinaryLogDecodesToTheTextOfEveryRecord) 
+{
+    file_name_ = "binary";
+    {
+        AsyncLogger logger(directory_, file_name_, OverflowPolicy::BLOCK, LogFormat::BINARY);
+        for (int id = 0; id < 100; ++id) 
+        {
+            logger.event<"Task {} changed state from {READY|RUNNING} to {READY|RUNNING}">(id, 0, 1);
+            logger.event<"Dequeued task with id: {}">(id);
+        }
+        logger.log("plain text");
+    }
+    AsyncLogger::flush();
+
+    std::ifstream input(directory_ + "/" + file_name_, std::ios::binary);
+    std::ostringstream output;
+    LogDecoder decoder;
+    EXPECT_EQ(decoder.decode(input, output), 201);
+
+    std::istringstream lines(output.str());
+    std::regex prefix(R"(\[\d\d\.\d\d\.\d{4} \d\d:\d\d:\d\d\] )");
+    std::string line;
+    for (int id = 0; id < 100; ++id) 
+    {
+        std::getline(lines, line);
+        EXPECT_EQ(std::regex_replace(line, prefix, ""), "Task " + std::to_string(id) + " changed state from READY to RUNNING");
+        std::getline(lines, line);
+        EXPECT_EQ(std::regex_replace(line, prefix, ""), "Dequeued task with id: " + std::to_string(id));
+    }
+    std::getline(lines, line);
+    EXPECT_EQ(std::regex_replace(line, prefix, ""), "plain text");
+
+    std::ifstream text_input(directory_ + "/blocking");
+    EXPECT_THROW(LogDecoder().decode(text_input, output), std::runtime_error);
+}
+
+TEST_F(AsyncLoggerTest, MessagesBelowTheThresholdAreNeitherBuiltNorWritten) 
+{
+    file_name_ = "levels";
+    int built = 0;
+    auto message = [&built](const std::string& text) 
+    {
+        ++built;
+        return text;
+    };
+    {
+        auto logger = std::make_shared<AsyncLogger>(directory_, file_name_, OverflowPolicy::BLOCK);
+        Logger::set_threshold(LogLevel::WARN);
+        LOG_INFO(logger, message("info"));
+        LOG_TRACE_EVENT(logger, "Dequeued task with id: {}", ++built);
+        LOG_WARN(logger, message("warn"));
+        LOG_ERROR(logger, message("error"));
+        Logger::set_threshold(LogLevel::OFF);
+        LOG_ERROR(logger, message("off"));
+        Logger::set_threshold(LogLevel::TRACE);
+    }
+    AsyncLogger::flush();
+
+    EXPECT_EQ(built, 2);
+    EXPECT_EQ(count_lines(R"(\[.*\] (warn|error))"), 2);
+    EXPECT_EQ(count_lines(R"(.*(info|off|Dequeued).*)"), 0);
+}
+
+TEST_F(AsyncLoggerTest, ChildProcessesLogThroughTheSharedChannelWithoutOpeningTheFile) 
+{
+    file_name_ = "shared";
+    auto logger = std::make_shared<SharedLogger>(directory_, file_name_, OverflowPolicy::BLOCK);
+    logger->log("parent");
+
+    pid_t child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) 
+    {
+        auto descriptors = [path = std::filesystem::path(directory_) / file_name_] 
+        {
+            size_t count = 0;
+            std::error_code error;
+            for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd"))
+                if (std::filesystem::read_symlink(entry.path(), error) == path)
+                    ++count;
+            return count;
+        };
+        size_t inherited = descriptors();
+        for (int id = 0; id < 100; ++id)
+            logger->event<"Dequeued task with id: {}">(id);
+        logger->log("child");
+        _exit(descriptors() == inherited ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    AsyncLogger::flush();
+    EXPECT_EQ(count_lines(R"(\[.*\] Dequeued task with id: \d+)"), 100);
+    EXPECT_EQ(count_lines(R"(\[.*\] (parent|child))"), 2);
+}
\ No newline at end of file
@@ -87,6 +87,22 @@ TEST(MethodsTestTask, AttributesWithBasicUnixTask)
     ASSERT_FALSE(missing_value.has_value());
 }
 
+TEST(MethodsTestTask, DeadlineThroughAttributesWithBasicUnixTask) 
+{
+    UnixTask task(1, "Test case");
+    ASSERT_EQ(task.get_deadline(), NO_DEADLINE);
+    ASSERT_FALSE(task.get_attribute(DEADLINE_ATTRIBUTE).has_value());
+
+    task.set_attribute(DEADLINE_ATTRIBUTE, std::chrono::milliseconds(250));
+    ASSERT_EQ(task.get_deadline(), task.get_arrival_time() + std::chrono::milliseconds(250));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    task.set_attribute(DEADLINE_ATTRIBUTE, deadline);
+    ASSERT_EQ(std::any_cast<std::chrono::steady_clock::time_point>(task.get_attribute(DEADLINE_ATTRIBUTE)), deadline);
+
+    ASSERT_THROW(task.set_attribute(DEADLINE_ATTRIBUTE, 250), std::invalid_argument);
+}
+
 TEST(MethodsTestTask, TaskStateWithBasicUnixTask) 
 {
     UnixTask task(1, "Test case");
@@ -101,4 +117,11 @@ TEST(MethodsTestTask, TaskStateWithBasicUnixTask)
 
     task.set_state(UnixTask::TaskState::WAITING);
     ASSERT_EQ(task.get_state(), UnixTask::TaskState::WAITING);
+}
+
+TEST(MethodsTestTask, TotalTimeIsUnknownWithBasicUnixTask) 
+{
+    UnixTask task(1, "add");
+
+    ASSERT_EQ(task.get_total_time(), std::chrono::milliseconds::zero());
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <CfsScheduling/CfsScheduling.hpp>
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+#include <TaskProcessor/TaskProcessor.hpp>
+#include <Tasks/Tasks.hpp>
+
+#include <map>
+
+TEST(CfsSchedulingTest, PicksTheSmallestVirtualRuntimeFirst) 
+{
+    CfsScheduling cfs;
+    for (int id = 1; id <= 3; ++id) 
+    {
+        auto task = std::make_shared<CpuIntensiveTask>(id, std::chrono::milliseconds(10));
+        task->set_virtual_runtime(static_cast<float>((4 - id) * 10));
+        cfs.enqueue(task);
+    }
+    EXPECT_EQ(cfs.runnable(), 3);
+
+    EXPECT_EQ(cfs.pick_next()->get_id(), 3);
+    EXPECT_EQ(cfs.pick_next()->get_id(), 2);
+    EXPECT_EQ(cfs.pick_next()->get_id(), 1);
+    EXPECT_EQ(cfs.pick_next(), nullptr);
+}
+
+TEST(CfsSchedulingTest, SharesRuntimeInProportionToNiceWeights) 
+{
+    CfsScheduling cfs;
+    auto normal = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(10));
+    auto nice = std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(10));
+    nice->set_static_priority(5);
+    cfs.enqueue(normal);
+    cfs.enqueue(nice);
+
+    std::map<int, int64_t> runtime;
+    for (int round = 0; round < 2000; ++round) 
+    {
+        auto task = cfs.pick_next();
+        auto slice = cfs.time_slice(*task, std::chrono::milliseconds(20));
+        cfs.task_ran(*task, slice, false);
+        runtime[task->get_id()] += slice.count();
+        cfs.enqueue(task);
+    }
+
+    double expected = static_cast<double>(CfsScheduling::weight_of(0)) / CfsScheduling::weight_of(5);
+    EXPECT_NEAR(static_cast<double>(runtime[1]) / runtime[2], expected, expected * 0.05);
+}
+
+TEST(CfsSchedulingTest, PlacesNewTasksAtTheMinimumVirtualRuntime) 
+{
+    CfsScheduling cfs;
+    auto running = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(10));
+    cfs.enqueue(running);
+    for (int round = 0; round < 10; ++round) 
+    {
+        auto task = cfs.pick_next();
+        cfs.task_ran(*task, std::chrono::milliseconds(10), false);
+        cfs.enqueue(task);
+    }
+    EXPECT_FLOAT_EQ(cfs.min_virtual_runtime(), 100.0f);
+
+    auto arrived = std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(10));
+    cfs.enqueue(arrived);
+    EXPECT_FLOAT_EQ(arrived->get_virtual_runtime(), 100.0f);
+}
+
+TEST(CfsSchedulingTest, ProcessorDispatchesFromTheRunQueue) 
+{
+    auto shared_memory = std::make_shared<PosixSharedMemory>("/test_cfs_processor", 100);
+    try 
+    {
+        shared_memory->create();
+    } 
+    catch (...) 
+    {
+        shared_memory->attach();
+    }
+    auto queue_manager = std::make_shared<TaskQueueManager>(shared_memory);
+    TaskProcessor processor(queue_manager, std::chrono::milliseconds(10));
+    processor.set_algorithm(std::make_shared<CfsScheduling>());
+
+    for (int id = 1; id <= 3; ++id)
+        queue_manager->add_task(std::make_shared<CpuIntensiveTask>(id, std::chrono::milliseconds(30)));
+
+    processor.start();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (queue_manager->registered_count() != 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    processor.stop();
+
+    EXPECT_EQ(queue_manager->registered_count(), 0);
+    EXPECT_EQ(queue_manager->task_count(), 0);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <EdfScheduling/EdfScheduling.hpp>
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+#include <PriorityScheduling/PriorityScheduling.hpp>
+#include <Sheduler/Sheduler.hpp>
+#include <TaskProcessor/TaskProcessor.hpp>
+#include <Tasks/Tasks.hpp>
+
+namespace
+{
+    std::shared_ptr<CpuIntensiveTask> make_task(int id, int work_ms, std::chrono::steady_clock::time_point deadline,
+        int priority = 0)
+    {
+        auto task = std::make_shared<CpuIntensiveTask>(id, std::chrono::milliseconds(work_ms));
+        task->set_deadline(deadline);
+        task->set_static_priority(priority);
+        return task;
+    }
+
+    DeadlineStatistics run_workload(const std::string& name, std::unique_ptr<SchedulingAlgorithm> algorithm)
+    {
+        auto shared_memory = std::make_shared<PosixSharedMemory>(name, 100);
+        try
+        {
+            shared_memory->create();
+        }
+        catch (...)
+        {
+            shared_memory->attach();
+        }
+        Scheduler scheduler(shared_memory);
+        scheduler.set_algorithm(std::move(algorithm));
+
+        // The tasks arrive in deadline order, but the most important one has the latest deadline:
+        // priority scheduling moves it to the front and runs task 3 last, after its deadline.
+        auto start = std::chrono::steady_clock::now();
+        scheduler.add_tasks({make_task(3, 60, start + std::chrono::milliseconds(100), 0),
+            make_task(2, 60, start + std::chrono::milliseconds(150), 5),
+            make_task(1, 60, start + std::chrono::seconds(5), 10)});
+
+        scheduler.start();
+        auto timeout = start + std::chrono::seconds(5);
+        auto finished = [&]()
+        {
+            auto statistics = scheduler.get_deadline_statistics();
+            return statistics.met_ + statistics.missed_ == 3;
+        };
+        while (!finished() && std::chrono::steady_clock::now() < timeout)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        scheduler.stop();
+        shared_memory->destroy();
+        return scheduler.get_deadline_statistics();
+    }
+}
+
+TEST(EdfSchedulingTest, PicksTheNearestDeadlineFirst)
+{
+    EdfScheduling edf;
+    auto now = std::chrono::steady_clock::now();
+    edf.enqueue(std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(10)));
+    edf.enqueue(make_task(2, 10, now + std::chrono::milliseconds(300)));
+    edf.enqueue(make_task(3, 10, now + std::chrono::milliseconds(100)));
+    edf.enqueue(make_task(4, 10, now + std::chrono::milliseconds(300)));
+    edf.enqueue(std::make_shared<CpuIntensiveTask>(5, std::chrono::milliseconds(10)));
+    EXPECT_EQ(edf.runnable(), 5);
+
+    for (int id : {3, 2, 4, 1, 5})
+        EXPECT_EQ(edf.pick_next()->get_id(), id);
+    EXPECT_EQ(edf.pick_next(), nullptr);
+}
+
+TEST(EdfSchedulingTest, AdmissionRejectsWorkThatCannotMeetDeadlines)
+{
+    auto now = std::chrono::steady_clock::now();
+    EdfScheduling edf(true);
+    edf.enqueue(make_task(1, 100, now + std::chrono::milliseconds(1000)));
+    edf.enqueue(make_task(2, 100, now + std::chrono::milliseconds(1000)));
+
+    EXPECT_FALSE(edf.admit(*make_task(3, 900, now + std::chrono::milliseconds(1000))));
+    EXPECT_FALSE(edf.admit(*make_task(4, 850, now + std::chrono::milliseconds(900))));
+    EXPECT_TRUE(edf.admit(*make_task(5, 500, now + std::chrono::milliseconds(2000))));
+    EXPECT_TRUE(edf.admit(*make_task(6, 500, now + std::chrono::milliseconds(600))));
+    EXPECT_TRUE(edf.admit(*std::make_shared<CpuIntensiveTask>(7, std::chrono::milliseconds(5000))));
+    EXPECT_EQ(edf.rejected(), 2);
+
+    EdfScheduling permissive;
+    EXPECT_TRUE(permissive.admit(*make_task(8, 100, now)));
+}
+
+TEST(EdfSchedulingTest, ProcessorReleasesRejectedTasks)
+{
+    auto shared_memory = std::make_shared<PosixSharedMemory>("/test_edf_admission", 100);
+    try
+    {
+        shared_memory->create();
+    }
+    catch (...)
+    {
+        shared_memory->attach();
+    }
+    auto queue_manager = std::make_shared<TaskQueueManager>(shared_memory);
+    TaskProcessor processor(queue_manager, std::chrono::milliseconds(10));
+    processor.set_algorithm(std::make_shared<EdfScheduling>(true));
+
+    queue_manager->add_task(make_task(1, 500, std::chrono::steady_clock::now() + std::chrono::milliseconds(50)));
+
+    processor.start();
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (queue_manager->registered_count() != 0 && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    processor.stop();
+    shared_memory->destroy();
+
+    auto statistics = processor.deadline_statistics();
+    EXPECT_EQ(queue_manager->registered_count(), 0);
+    EXPECT_EQ(statistics.rejected_, 1);
+    EXPECT_EQ(statistics.met_ + statistics.missed_, 0);
+}
+
+TEST(EdfSchedulingTest, MissesFewerDeadlinesThanPriorityScheduling)
+{
+    auto edf = run_workload("/test_edf_processor", std::make_unique<EdfScheduling>());
+    auto priority = run_workload("/test_edf_priority", std::make_unique<PriorityScheduling>());
+
+    EXPECT_EQ(edf.met_ + edf.missed_, 3);
+    EXPECT_EQ(priority.met_ + priority.missed_, 3);
+    EXPECT_LT(edf.missed_, priority.missed_);
+}
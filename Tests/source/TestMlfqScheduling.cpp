@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <MlfqScheduling/MlfqScheduling.hpp>
+#include <Tasks/Tasks.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief A task that claims a chosen share of every quantum without spending any time.
+     */
+    class ScriptedTask : public UnixTask
+    {
+    public:
+        ScriptedTask(int id, float usage) : UnixTask(id, "Scripted Task"), usage_(usage) {}
+
+        void set_usage(float usage) noexcept
+        {
+            usage_ = usage;
+        }
+
+        bool execute(std::chrono::milliseconds quantum) override
+        {
+            last_run_ = std::chrono::duration_cast<std::chrono::nanoseconds>(quantum * usage_);
+            return false;
+        }
+
+        [[nodiscard]] inline std::chrono::nanoseconds last_run() const noexcept
+        {
+            return last_run_;
+        }
+
+    private:
+        float usage_;
+        std::chrono::nanoseconds last_run_{0};
+    };
+
+    /**
+     * @brief Runs the tasks of the run queue the way the TaskProcessor does.
+     *
+     * Scripted tasks report the time they claimed, all other tasks the wall time of their run.
+     *
+     * @return The ids of the tasks in the order they completed.
+     */
+    std::vector<int> run(MlfqScheduling& mlfq, size_t rounds, const std::function<void(size_t)>& arrivals = {})
+    {
+        std::vector<int> completed;
+        for (size_t round = 0; round < rounds && mlfq.runnable() != 0; ++round)
+        {
+            if (arrivals)
+                arrivals(round);
+            auto task = mlfq.pick_next();
+            auto slice = mlfq.time_slice(*task, std::chrono::milliseconds(100));
+            auto start = std::chrono::steady_clock::now();
+            bool done = task->execute(slice);
+            std::chrono::nanoseconds ran = std::chrono::steady_clock::now() - start;
+            if (auto scripted = std::dynamic_pointer_cast<ScriptedTask>(task))
+                ran = scripted->last_run();
+            mlfq.task_ran(*task, ran, done);
+            if (done)
+                completed.push_back(task->get_id());
+            else
+                mlfq.enqueue(task);
+        }
+        return completed;
+    }
+}
+
+TEST(MlfqSchedulingTest, DemotesTasksThatUseTheirWholeQuantum)
+{
+    MlfqScheduling mlfq;
+    auto task = std::make_shared<ScriptedTask>(1, 1.0f);
+    mlfq.enqueue(task);
+
+    for (size_t level = 0; level < MLFQ_LEVELS; ++level)
+    {
+        EXPECT_EQ(mlfq.level_of(1), level);
+        EXPECT_EQ(mlfq.time_slice(*task, std::chrono::milliseconds(100)).count(), MLFQ_TOP_QUANTUM_MS << level);
+        run(mlfq, 1);
+    }
+    EXPECT_EQ(mlfq.level_of(1), MLFQ_LEVELS - 1);
+}
+
+TEST(MlfqSchedulingTest, PromotesTasksThatYieldEarly)
+{
+    MlfqScheduling mlfq;
+    auto task = std::make_shared<ScriptedTask>(1, 1.0f);
+    mlfq.enqueue(task);
+    run(mlfq, 2);
+    EXPECT_EQ(mlfq.level_of(1), 2);
+
+    task->set_usage(0.7f);
+    run(mlfq, 1);
+    EXPECT_EQ(mlfq.level_of(1), 2);
+
+    task->set_usage(0.2f);
+    run(mlfq, 1);
+    EXPECT_EQ(mlfq.level_of(1), 1);
+    run(mlfq, 2);
+    EXPECT_EQ(mlfq.level_of(1), 0);
+}
+
+TEST(MlfqSchedulingTest, PicksTheHighestLevelInArrivalOrder)
+{
+    MlfqScheduling mlfq;
+    auto demoted = std::make_shared<ScriptedTask>(1, 1.0f);
+    mlfq.enqueue(demoted);
+    run(mlfq, 1);
+
+    for (int id = 2; id <= 4; ++id)
+        mlfq.enqueue(std::make_shared<ScriptedTask>(id, 0.0f));
+    EXPECT_EQ(mlfq.runnable(), 4);
+
+    for (int id : {2, 3, 4, 1})
+        EXPECT_EQ(mlfq.pick_next()->get_id(), id);
+    EXPECT_EQ(mlfq.pick_next(), nullptr);
+    EXPECT_EQ(mlfq.runnable(), 0);
+}
+
+TEST(MlfqSchedulingTest, BoostMovesEveryTaskToTheTopLevel)
+{
+    MlfqScheduling mlfq;
+    for (int id = 1; id <= 3; ++id)
+        mlfq.enqueue(std::make_shared<ScriptedTask>(id, 1.0f));
+    run(mlfq, 6);
+    for (int id = 1; id <= 3; ++id)
+        EXPECT_EQ(mlfq.level_of(id), 2);
+
+    mlfq.boost();
+    for (int id = 1; id <= 3; ++id)
+    {
+        EXPECT_EQ(mlfq.level_of(id), 0);
+        EXPECT_EQ(mlfq.pick_next()->get_id(), id);
+    }
+}
+
+TEST(MlfqSchedulingTest, ShortRequestsFinishAheadOfLongTasks)
+{
+    MlfqScheduling mlfq;
+    for (int id = 1; id <= 2; ++id)
+        mlfq.enqueue(std::make_shared<CpuIntensiveTask>(id, std::chrono::milliseconds(100)));
+    run(mlfq, 4);
+
+    for (int id = 3; id <= 6; ++id)
+        mlfq.enqueue(std::make_shared<CpuIntensiveTask>(id, std::chrono::milliseconds(2)));
+
+    auto completed = run(mlfq, 100);
+    ASSERT_EQ(completed.size(), 6);
+    EXPECT_EQ(std::vector<int>(completed.begin(), completed.begin() + 4), std::vector<int>({3, 4, 5, 6}));
+}
+
+TEST(MlfqSchedulingTest, BoostKeepsLongTasksFromStarving)
+{
+    MlfqScheduling mlfq(std::chrono::milliseconds(MLFQ_TOP_QUANTUM_MS), std::chrono::milliseconds(50));
+    mlfq.enqueue(std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(60)));
+
+    int next_id = 2;
+    auto completed = run(mlfq, 400, [&](size_t)
+    {
+        mlfq.enqueue(std::make_shared<CpuIntensiveTask>(next_id++, std::chrono::milliseconds(2)));
+    });
+    EXPECT_NE(std::find(completed.begin(), completed.end(), 1), completed.end());
+}
\ No newline at end of file
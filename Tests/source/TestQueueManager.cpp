@@ -78,6 +78,23 @@ TEST_F(TaskQueueManagerTest, ReorderTasksWithPriorityScheduling)
     EXPECT_EQ(next_task->get_id(), 1);
 }
 
+TEST_F(TaskQueueManagerTest, ReorderTasksSortsByPriority) 
+{
+    int priorities[] = {0, 10, 5, 10};
+    for (int id = 1; id <= 4; ++id) 
+    {
+        auto task = std::make_shared<UnixTask>(id, "Task " + std::to_string(id));
+        task->set_static_priority(priorities[id - 1]);
+        queue_manager_->add_task(task);
+    }
+
+    queue_manager_->reorder_tasks(std::make_shared<PriorityScheduling>());
+    EXPECT_EQ(queue_manager_->task_count(), 4);
+
+    for (int id : {2, 4, 3, 1})
+        EXPECT_EQ(queue_manager_->get_next_task()->get_id(), id);
+}
+
 TEST_F(TaskQueueManagerTest, ReorderTasksWithRoundRobinScheduling) 
 {
     auto task1 = std::make_shared<UnixTask>(1, "Task 1");
@@ -126,4 +143,137 @@ TEST_F(TaskQueueManagerTest, ReorderTasksWithEmptyQueueUsingPriorityScheduling)
     queue_manager_->reorder_tasks(algorithm);
 
     EXPECT_EQ(queue_manager_->task_count(), 0);
-}
\ No newline at end of file
+}
+
+TEST_F(TaskQueueManagerTest, AddTasksInBulk) 
+{
+    std::vector<std::shared_ptr<GeneralTask>> tasks;
+    for (int i = 1; i <= 5; ++i) 
+        tasks.push_back(std::make_shared<UnixTask>(i, "Task " + std::to_string(i)));
+
+    queue_manager_->add_tasks(tasks);
+    EXPECT_EQ(queue_manager_->task_count(), 5);
+
+    queue_manager_->reorder_tasks(std::make_shared<RoundRobinScheduling>());
+    EXPECT_EQ(queue_manager_->task_count(), 5);
+
+    for (int i = 1; i <= 5; ++i) 
+        EXPECT_EQ(queue_manager_->get_next_task()->get_id(), i);
+}
+
+TEST_F(TaskQueueManagerTest, DequeueReturnsRegisteredTaskObject) 
+{
+    auto task = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(500));
+    task->set_static_priority(5);
+    queue_manager_->add_task(task);
+    EXPECT_EQ(queue_manager_->registered_count(), 1);
+
+    queue_manager_->reorder_tasks(std::make_shared<PriorityScheduling>());
+    auto retrieved_task = queue_manager_->get_next_task();
+    EXPECT_EQ(retrieved_task, task);
+
+    queue_manager_->add_task(retrieved_task);
+    EXPECT_EQ(queue_manager_->registered_count(), 1);
+    EXPECT_EQ(queue_manager_->get_next_task(), task);
+
+    queue_manager_->release_task(task);
+    EXPECT_EQ(queue_manager_->registered_count(), 0);
+}
+
+TEST_F(TaskQueueManagerTest, ForeignRecordsAreConvertedOnce) 
+{
+    SharedTask record{7, 3, "Foreign Task", TaskType::UNIX_TASK, false};
+    shared_memory_->enqueue(record);
+
+    auto task = queue_manager_->get_next_task();
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task->get_id(), 7);
+    EXPECT_EQ(task->get_description(), "Foreign Task");
+    EXPECT_EQ(queue_manager_->registered_count(), 1);
+
+    shared_memory_->enqueue(record);
+    EXPECT_EQ(queue_manager_->get_next_task(), task);
+
+    auto other = std::make_shared<IoBoundTask>(7, "output.txt", 1);
+    EXPECT_THROW(queue_manager_->add_task(other), std::invalid_argument);
+    EXPECT_THROW(queue_manager_->add_tasks({std::make_shared<UnixTask>(8, "Task 8"), other}), std::invalid_argument);
+    EXPECT_EQ(queue_manager_->task_count(), 0);
+    EXPECT_EQ(queue_manager_->registered_count(), 1);
+
+    SharedTask foreign{7, 3, "Foreign I/O Task", TaskType::IO_BOUND_TASK, false};
+    shared_memory_->enqueue(foreign);
+    EXPECT_THROW(queue_manager_->get_next_task(), std::runtime_error);
+
+    queue_manager_->release_task(task);
+    queue_manager_->add_task(other);
+    auto retrieved_task = queue_manager_->get_next_task();
+    EXPECT_NE(retrieved_task, task);
+    EXPECT_NE(std::dynamic_pointer_cast<IoBoundTask>(retrieved_task), nullptr);
+}
+
+TEST_F(TaskQueueManagerTest, MaxTaskIdCoversQueuedAndRegisteredTasks) 
+{
+    EXPECT_EQ(queue_manager_->max_task_id(), 0);
+
+    SharedTask recovered{1200, 0, "Recovered Task", TaskType::UNIX_TASK, false};
+    shared_memory_->enqueue(recovered);
+    queue_manager_->add_task(std::make_shared<UnixTask>(1001, "Task"));
+    EXPECT_EQ(queue_manager_->max_task_id(), 1200);
+
+    auto task = queue_manager_->get_next_task();
+    ASSERT_EQ(task->get_id(), 1200);
+    EXPECT_EQ(queue_manager_->max_task_id(), 1200);
+    queue_manager_->release_task(task);
+    EXPECT_EQ(queue_manager_->max_task_id(), 1001);
+}
+
+TEST_F(TaskQueueManagerTest, RequeuedTasksResumeWhereTheyStopped) 
+{
+    auto cpu = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(200));
+    cpu->execute(std::chrono::milliseconds(20));
+    TaskProgress cpu_progress;
+    cpu->save_progress(cpu_progress);
+    ASSERT_LT(cpu_progress.remaining_work_, 200);
+
+    SharedTask cpu_record{1, 0, "CPU-Intensive Task", TaskType::CPU_INTENSIVE_TASK, false, cpu_progress};
+    SharedTask io_record{2, 0, "I/O-Bound Task: progress.txt", TaskType::IO_BOUND_TASK, false, {3, 1.5f, 0.25f}};
+    shared_memory_->enqueue(cpu_record);
+    shared_memory_->enqueue(io_record);
+
+    TaskProgress progress;
+    auto resumed_cpu = queue_manager_->get_next_task();
+    ASSERT_NE(std::dynamic_pointer_cast<CpuIntensiveTask>(resumed_cpu), nullptr);
+    resumed_cpu->save_progress(progress);
+    EXPECT_EQ(progress.remaining_work_, cpu_progress.remaining_work_);
+
+    auto resumed_io = queue_manager_->get_next_task();
+    ASSERT_NE(std::dynamic_pointer_cast<IoBoundTask>(resumed_io), nullptr);
+    EXPECT_EQ(resumed_io->get_description(), "I/O-Bound Task: progress.txt");
+    resumed_io->save_progress(progress);
+    EXPECT_EQ(progress.remaining_work_, 3);
+    EXPECT_FLOAT_EQ(progress.virtual_runtime_, 1.5f);
+    EXPECT_NEAR(progress.cpu_usage_, 0.25f, 1e-4f);
+}
+
+
+TEST(TaskTypesTest, ConstructsTheRegisteredClassOfEachTag) 
+{
+    static_assert(TaskTypes::contains(TaskType::UNIX_TASK) && TaskTypes::contains(TaskType::CPU_INTENSIVE_TASK) &&
+                  TaskTypes::contains(TaskType::IO_BOUND_TASK));
+
+    for (std::shared_ptr<GeneralTask> task : {std::shared_ptr<GeneralTask>(std::make_shared<UnixTask>(1, "Unix Task")),
+             std::shared_ptr<GeneralTask>(std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(50))),
+             std::shared_ptr<GeneralTask>(std::make_shared<IoBoundTask>(3, "types.txt", 4))}) 
+    {
+        SharedTask record{task->get_id(), 0, "", task->get_type(), false, {}};
+        strncpy(record.description_, task->get_description().c_str(), MAX_PATH - 1);
+        task->save_progress(record.progress_);
+
+        auto constructed = TaskTypes::construct(record);
+        EXPECT_EQ(constructed->get_type(), task->get_type());
+        EXPECT_EQ(constructed->get_description(), task->get_description());
+    }
+
+    SharedTask unknown{4, 0, "Unknown", static_cast<TaskType>(200), false, {}};
+    EXPECT_EQ(TaskTypes::construct(unknown)->get_type(), TaskType::UNIX_TASK);
+}
@@ -37,7 +37,10 @@ TEST(SchedulerTest, AddTask)
     EXPECT_EQ(scheduler.get_count(), 1);
 
     scheduler.add_task(std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(15)));
-    scheduler.add_task(std::make_shared<IoBoundTask>(2, "output.txt", 10));
+    scheduler.add_task(std::make_shared<IoBoundTask>(3, "output.txt", 10));
+    EXPECT_EQ(scheduler.get_count(), 3);
+
+    EXPECT_THROW(scheduler.add_task(std::make_shared<IoBoundTask>(2, "output.txt", 10)), std::invalid_argument);
     EXPECT_EQ(scheduler.get_count(), 3);
 
     scheduler.start();
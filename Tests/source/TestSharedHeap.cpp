@@ -0,0 +1,172 @@
+#include <PosixSharedHeap/PosixSharedHeap.hpp>
+#include <TaskQueueManager/TaskQueueManager.hpp>
+#include <PriorityScheduling/PriorityScheduling.hpp>
+#include <Tasks/Tasks.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+class PosixSharedHeapTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        sem_unlink("/test_heap_mut");
+        shm_unlink("/test_heap");
+    }
+
+    void TearDown() override
+    {
+        sem_unlink("/test_heap_mut");
+        shm_unlink("/test_heap");
+    }
+};
+
+TEST_F(PosixSharedHeapTest, DequeuesHighestPriorityFirst)
+{
+    PosixSharedHeap heap("/test_heap", 16);
+    heap.create();
+    EXPECT_TRUE(heap.is_priority_ordered());
+
+    for (int priority : {3, -20, 19, 0, 7, 7, -5})
+        heap.enqueue(SharedTask{priority + 100, priority, "Task", TaskType::UNIX_TASK, false});
+    EXPECT_EQ(heap.size(), 7);
+
+    std::vector<int> order;
+    while (!heap.empty())
+        order.push_back(heap.dequeue().priority_);
+    EXPECT_EQ(order, (std::vector<int>{19, 7, 7, 3, 0, -5, -20}));
+}
+
+TEST_F(PosixSharedHeapTest, EqualPrioritiesStayFifo)
+{
+    PosixSharedHeap heap("/test_heap", 8);
+    heap.create();
+
+    for (int id = 1; id <= 8; ++id)
+        heap.enqueue(SharedTask{id, 0, "Task", TaskType::UNIX_TASK, false});
+
+    for (int id = 1; id <= 8; ++id)
+        EXPECT_EQ(heap.dequeue().id_, id);
+}
+
+TEST_F(PosixSharedHeapTest, UpdatePriorityInPlace)
+{
+    PosixSharedHeap heap("/test_heap", 8);
+    heap.create();
+
+    for (int id = 1; id <= 5; ++id)
+        heap.enqueue(SharedTask{id, id, "Task", TaskType::UNIX_TASK, false});
+
+    EXPECT_EQ(heap.update_priority(1, 10), 1);
+    EXPECT_EQ(heap.update_priority(5, -1), 1);
+    EXPECT_EQ(heap.update_priority(42, 0), 0);
+    EXPECT_EQ(heap.size(), 5);
+
+    SharedTask first = heap.dequeue();
+    EXPECT_EQ(first.id_, 1);
+    EXPECT_EQ(first.priority_, 10);
+    EXPECT_EQ(heap.dequeue().id_, 4);
+    EXPECT_EQ(heap.dequeue().id_, 3);
+    EXPECT_EQ(heap.dequeue().id_, 2);
+    EXPECT_EQ(heap.dequeue().id_, 5);
+}
+
+TEST_F(PosixSharedHeapTest, UpdatePriorityAfterSlotReuse)
+{
+    PosixSharedHeap heap("/test_heap", 4);
+    heap.create();
+
+    for (int round = 0; round < 50; ++round)
+    {
+        heap.enqueue(SharedTask{round, 0, "Task", TaskType::UNIX_TASK, false});
+        heap.enqueue(SharedTask{round + 1000, 1, "Task", TaskType::UNIX_TASK, false});
+        EXPECT_EQ(heap.update_priority(round, 2), 1);
+        EXPECT_EQ(heap.dequeue().id_, round);
+        EXPECT_EQ(heap.dequeue().id_, round + 1000);
+    }
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST_F(PosixSharedHeapTest, BulkAndTimedDequeue)
+{
+    PosixSharedHeap heap("/test_heap", 4);
+    heap.create();
+
+    EXPECT_FALSE(heap.try_dequeue().has_value());
+    EXPECT_FALSE(heap.dequeue_for(std::chrono::milliseconds(10)).has_value());
+
+    std::vector<SharedTask> tasks;
+    for (int id = 1; id <= 10; ++id)
+        tasks.push_back(SharedTask{id, id % 3, "Task", TaskType::UNIX_TASK, false});
+
+    std::thread producer([&heap, &tasks]() { heap.enqueue_bulk(tasks); });
+
+    std::vector<SharedTask> received(10);
+    size_t taken = 0;
+    while (taken < tasks.size())
+        taken += heap.dequeue_bulk(std::span<SharedTask>(received).subspan(taken), tasks.size() - taken);
+    producer.join();
+
+    EXPECT_TRUE(heap.empty());
+    std::vector<int> ids;
+    for (const auto& task : received)
+        ids.push_back(task.id_);
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST_F(PosixSharedHeapTest, AttachSharesHeap)
+{
+    PosixSharedHeap owner("/test_heap", 8);
+    owner.create();
+    owner.enqueue(SharedTask{1, 1, "Task", TaskType::UNIX_TASK, false});
+    owner.enqueue(SharedTask{2, 5, "Task", TaskType::UNIX_TASK, false});
+
+    PosixSharedHeap client("/test_heap", 1);
+    client.attach();
+    EXPECT_EQ(client.capacity(), 8);
+    EXPECT_EQ(client.size(), 2);
+    EXPECT_EQ(client.dequeue().id_, 2);
+    client.detach();
+
+    EXPECT_EQ(owner.dequeue().id_, 1);
+}
+
+TEST_F(PosixSharedHeapTest, QueueManagerSkipsReorder)
+{
+    auto heap = std::make_shared<PosixSharedHeap>("/test_heap", 16);
+    heap->create();
+    TaskQueueManager queue_manager(heap);
+
+    auto task1 = std::make_shared<UnixTask>(1, "Task 1");
+    auto task2 = std::make_shared<UnixTask>(2, "Task 2");
+    task1->set_static_priority(5);
+    task2->set_static_priority(10);
+
+    queue_manager.add_task(task1);
+    queue_manager.add_task(task2);
+    queue_manager.reorder_tasks(std::make_shared<PriorityScheduling>());
+    EXPECT_EQ(queue_manager.task_count(), 2);
+
+    auto next_task = queue_manager.get_next_task();
+    ASSERT_NE(next_task, nullptr);
+    EXPECT_EQ(next_task->get_id(), 2);
+}
+
+TEST_F(PosixSharedHeapTest, SnapshotIsInDequeueOrder)
+{
+    PosixSharedHeap heap("/test_heap", 8);
+    heap.create();
+    for (int id = 1; id <= 5; ++id)
+        heap.enqueue(SharedTask{id, (id * 7) % 5, "Task", TaskType::UNIX_TASK, false});
+
+    size_t visited = 0;
+    heap.for_each_slot([&visited](const TaskView& task) { visited += task.id_ != 0; });
+    EXPECT_EQ(visited, 5);
+
+    std::vector<SharedTask> tasks(3);
+    ASSERT_EQ(heap.snapshot(tasks), 3);
+    for (auto& task : tasks)
+        EXPECT_EQ(task.id_, heap.dequeue().id_);
+}
\ No newline at end of file
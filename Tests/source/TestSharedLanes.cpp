@@ -0,0 +1,174 @@
+#include <PosixSharedLanes/PosixSharedLanes.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+class PosixSharedLanesTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        shm_unlink("/test_lanes");
+    }
+
+    void TearDown() override
+    {
+        shm_unlink("/test_lanes");
+    }
+};
+
+TEST_F(PosixSharedLanesTest, RoundRobinMergesLanesInTurn)
+{
+    PosixSharedLanes lanes("/test_lanes", 2, 8, LaneMerge::ROUND_ROBIN);
+    lanes.create();
+    EXPECT_FALSE(lanes.is_priority_ordered());
+    EXPECT_EQ(lanes.capacity(), 16);
+
+    auto first = lanes.register_producer();
+    auto second = lanes.register_producer();
+    EXPECT_NE(first.lane(), second.lane());
+
+    for (int id = 1; id <= 3; ++id)
+        first.enqueue(SharedTask{id, 0, "Task", TaskType::UNIX_TASK, false});
+    second.enqueue(SharedTask{11, 0, "Task", TaskType::UNIX_TASK, false});
+    EXPECT_EQ(lanes.size(), 4);
+
+    std::vector<int> order;
+    while (auto task = lanes.try_dequeue())
+        order.push_back(task->id_);
+
+    std::vector<int> expected = first.lane() < second.lane() ? std::vector<int>{1, 11, 2, 3}
+                                                             : std::vector<int>{11, 1, 2, 3};
+    EXPECT_EQ(order, expected);
+    EXPECT_TRUE(lanes.empty());
+}
+
+TEST_F(PosixSharedLanesTest, PriorityMergeTakesHighestLaneHead)
+{
+    PosixSharedLanes lanes("/test_lanes", 2, 8, LaneMerge::PRIORITY);
+    lanes.create();
+    EXPECT_TRUE(lanes.is_priority_ordered());
+
+    auto first = lanes.register_producer();
+    auto second = lanes.register_producer();
+
+    std::vector<SharedTask> batch = {
+        {1, 5, "Task", TaskType::UNIX_TASK, false},
+        {2, 10, "Task", TaskType::UNIX_TASK, false}
+    };
+    first.enqueue_bulk(batch);
+    second.enqueue(SharedTask{3, 7, "Task", TaskType::UNIX_TASK, false});
+
+    std::vector<SharedTask> received(3);
+    EXPECT_EQ(lanes.try_dequeue_bulk(received, 3), 3);
+    EXPECT_EQ(received[0].id_, 3);
+    EXPECT_EQ(received[1].id_, 1);
+    EXPECT_EQ(received[2].id_, 2);
+}
+
+TEST_F(PosixSharedLanesTest, LanesAreExhaustedAndReused)
+{
+    PosixSharedLanes lanes("/test_lanes", 2, 4);
+    lanes.create();
+
+    auto first = lanes.register_producer();
+    {
+        auto second = lanes.register_producer();
+        EXPECT_THROW(lanes.register_producer(), std::runtime_error);
+        second.enqueue(SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    }
+
+    auto third = lanes.register_producer();
+    EXPECT_NE(third.lane(), first.lane());
+    EXPECT_EQ(lanes.dequeue().id_, 1);
+
+    EXPECT_THROW(PosixSharedLanes("/test_lanes", 0), std::invalid_argument);
+    EXPECT_THROW(PosixSharedLanes("/test_lanes", MAX_LANES + 1), std::invalid_argument);
+    EXPECT_THROW(PosixSharedLanes("/test_lanes", 2, 0), std::invalid_argument);
+}
+
+TEST_F(PosixSharedLanesTest, ProducersKeepPerLaneFifoOrder)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int TASKS = 2000;
+
+    PosixSharedLanes lanes("/test_lanes", PRODUCERS, 16, LaneMerge::ROUND_ROBIN);
+    lanes.create();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&lanes, p]()
+        {
+            auto producer = lanes.register_producer();
+            for (int i = 0; i < TASKS; ++i)
+                producer.enqueue(SharedTask{p * TASKS + i, p, "Task", TaskType::UNIX_TASK, false});
+        });
+    }
+
+    std::vector<int> next(PRODUCERS, 0);
+    int received = 0;
+    while (received < PRODUCERS * TASKS)
+    {
+        auto task = lanes.dequeue_for(std::chrono::milliseconds(1000));
+        ASSERT_TRUE(task.has_value());
+        int producer = task->priority_;
+        EXPECT_EQ(task->id_, producer * TASKS + next[producer]);
+        ++next[producer];
+        ++received;
+    }
+
+    for (auto& t : producers)
+        t.join();
+    EXPECT_TRUE(lanes.empty());
+}
+
+TEST_F(PosixSharedLanesTest, AttachSharesLanes)
+{
+    PosixSharedLanes owner("/test_lanes", 3, 8, LaneMerge::ROUND_ROBIN);
+    owner.create();
+
+    PosixSharedLanes client("/test_lanes", 1, 1);
+    client.attach();
+    EXPECT_EQ(client.lanes(), 3);
+    EXPECT_EQ(client.capacity(), 24);
+    EXPECT_FALSE(client.is_priority_ordered());
+
+    client.enqueue(SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    client.detach();
+
+    SharedTask task = owner.dequeue();
+    EXPECT_EQ(task.id_, 1);
+    EXPECT_STREQ(task.description_, "Task");
+}
+
+TEST_F(PosixSharedLanesTest, SnapshotCopiesWrappedLanes)
+{
+    PosixSharedLanes lanes("/test_lanes", 2, 4, LaneMerge::ROUND_ROBIN);
+    lanes.create();
+
+    auto first = lanes.register_producer();
+    auto second = lanes.register_producer();
+    for (int id = 1; id <= 3; ++id)
+        first.enqueue(SharedTask{id, 0, "Task", TaskType::UNIX_TASK, false});
+    std::vector<SharedTask> drained(4);
+    EXPECT_EQ(lanes.try_dequeue_bulk(drained, 2), 2);
+    for (int id = 4; id <= 6; ++id)
+        first.enqueue(SharedTask{id, 0, "Task", TaskType::UNIX_TASK, false});
+    second.enqueue(SharedTask{10, 0, "Task", TaskType::UNIX_TASK, false});
+
+    std::vector<int> visited;
+    lanes.for_each_slot([&visited](const TaskView& task) { visited.push_back(task.id_); });
+    EXPECT_EQ(visited.size(), 5);
+
+    std::vector<SharedTask> tasks(8);
+    tasks.resize(lanes.snapshot(tasks));
+    std::vector<int> copied;
+    for (const auto& task : tasks)
+        copied.push_back(task.id_);
+    EXPECT_EQ(copied, visited);
+
+    std::vector<int> expected_first = {3, 4, 5, 6};
+    std::vector<int> lane_of_first(copied.begin() + (first.lane() == 0 ? 0 : 1), copied.begin() + (first.lane() == 0 ? 4 : 5));
+    EXPECT_EQ(lane_of_first, expected_first);
+}
\ No newline at end of file
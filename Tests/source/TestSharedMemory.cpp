@@ -1,6 +1,10 @@
 #include <PosixSharedMemory/PosixSharedMemory.hpp>
 #include <gtest/gtest.h>
 #include <thread>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 #include <vector>
 
 class PosixSharedMemoryTest : public ::testing::Test 
@@ -40,9 +44,9 @@ TEST_F(PosixSharedMemoryTest, CircularBufferBehavior)
     shm.create();
 
     SharedTask tasks[3] = {
-        {1, 1, "Task1", TaskType::UNIX_TASK, false, 100},
-        {2, 2, "Task2", TaskType::UNIX_TASK, false, 200},
-        {3, 3, "Task3", TaskType::UNIX_TASK,false, 300}
+        {1, 1, "Task1", TaskType::UNIX_TASK, false},
+        {2, 2, "Task2", TaskType::UNIX_TASK, false},
+        {3, 3, "Task3", TaskType::UNIX_TASK,false}
     };
 
     for (auto& task : tasks) 
@@ -53,7 +57,7 @@ TEST_F(PosixSharedMemoryTest, CircularBufferBehavior)
     shm.dequeue();
     EXPECT_EQ(shm.size(), 1);
 
-    SharedTask task4{4, 4, "Task4", TaskType::UNIX_TASK, false, 400};
+    SharedTask task4{4, 4, "Task4", TaskType::UNIX_TASK, false};
     shm.enqueue(task4);
     EXPECT_EQ(shm.size(), 2);
 
@@ -77,7 +81,7 @@ TEST_F(PosixSharedMemoryTest, MultithreadedAccess)
         {
             for (int j = 0; j < tasks_per_thread; ++j) 
             {
-                SharedTask task{i * 100 + j, j, "Task", TaskType::UNIX_TASK, false, 100};
+                SharedTask task{i * 100 + j, j, "Task", TaskType::UNIX_TASK, false};
                 shm.enqueue(task);
             }
         });
@@ -116,8 +120,8 @@ TEST_F(PosixSharedMemoryTest, EnqueueDequeueSingleThread)
     PosixSharedMemory shm("/test_shm", 5);
     shm.create();
 
-    SharedTask task1{1, 10, "Task1", TaskType::UNIX_TASK, false, 100};
-    SharedTask task2{2, 5, "Task2", TaskType::UNIX_TASK, false, 200};
+    SharedTask task1{1, 10, "Task1", TaskType::UNIX_TASK, false};
+    SharedTask task2{2, 5, "Task2", TaskType::UNIX_TASK, false};
     
     EXPECT_NO_THROW(shm.enqueue(task1));
     EXPECT_EQ(shm.size(), 1);
@@ -148,3 +152,617 @@ TEST_F(PosixSharedMemoryTest, SchedulerFlag)
     shm.set_scheduler_running(false);
     EXPECT_FALSE(shm.is_scheduler_running());
 }
+
+TEST_F(PosixSharedMemoryTest, LockFreeCircularBufferBehavior) 
+{
+    PosixSharedMemory shm("/test_shm", 3, QueueMode::LOCK_FREE);
+    shm.create();
+    EXPECT_EQ(shm.mode(), QueueMode::LOCK_FREE);
+
+    SharedTask tasks[3] = {
+        {1, 1, "Task1", TaskType::UNIX_TASK, false},
+        {2, 2, "Task2", TaskType::UNIX_TASK, false},
+        {3, 3, "Task3", TaskType::UNIX_TASK, false}
+    };
+
+    for (auto& task : tasks) 
+        shm.enqueue(task);
+    EXPECT_EQ(shm.size(), 3);
+
+    EXPECT_EQ(shm.dequeue().id_, 1);
+    EXPECT_EQ(shm.dequeue().id_, 2);
+    EXPECT_EQ(shm.size(), 1);
+
+    SharedTask task4{4, 4, "Task4", TaskType::UNIX_TASK, false};
+    shm.enqueue(task4);
+    EXPECT_EQ(shm.size(), 2);
+
+    EXPECT_EQ(shm.dequeue().id_, 3);
+    EXPECT_EQ(shm.dequeue().id_, 4);
+    EXPECT_TRUE(shm.empty());
+}
+
+TEST_F(PosixSharedMemoryTest, LockFreeMultithreadedBlocking) 
+{
+    PosixSharedMemory shm("/test_shm", 4, QueueMode::LOCK_FREE);
+    shm.create();
+
+    const int num_threads = 4;
+    const int tasks_per_thread = 1000;
+    std::vector<std::thread> threads;
+    std::atomic<long> id_sum{0};
+
+    for (int i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&shm, i]() 
+        {
+            for (int j = 0; j < tasks_per_thread; ++j) 
+            {
+                SharedTask task{i * tasks_per_thread + j, j, "Task", TaskType::UNIX_TASK, false};
+                shm.enqueue(task);
+            }
+        });
+        threads.emplace_back([&shm, &id_sum]() 
+        {
+            for (int j = 0; j < tasks_per_thread; ++j) 
+                id_sum += shm.dequeue().id_;
+        });
+    }
+
+    for (auto& t : threads) t.join();
+
+    const long total = num_threads * tasks_per_thread;
+    EXPECT_EQ(id_sum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(shm.empty());
+}
+
+TEST_F(PosixSharedMemoryTest, LockFreeAttachAdoptsMode) 
+{
+    PosixSharedMemory owner("/test_shm", 10, QueueMode::LOCK_FREE);
+    owner.create();
+
+    PosixSharedMemory other("/test_shm", 10);
+    other.attach();
+    EXPECT_EQ(other.mode(), QueueMode::LOCK_FREE);
+
+    SharedTask task{7, 0, "Task", TaskType::UNIX_TASK, false};
+    other.enqueue(task);
+    EXPECT_EQ(owner.dequeue().id_, 7);
+    other.detach();
+}
+
+TEST_F(PosixSharedMemoryTest, LargeCapacityKeepsCounters) 
+{
+    const size_t capacity = 200000;
+    PosixSharedMemory shm("/test_shm", capacity);
+    shm.create();
+
+    for (size_t i = 0; i < capacity; ++i) 
+    {
+        SharedTask task{static_cast<int>(i), 0, "Task", TaskType::UNIX_TASK, false};
+        shm.enqueue(task);
+    }
+    EXPECT_EQ(shm.size(), capacity);
+
+    for (size_t i = 0; i < capacity; ++i) 
+        ASSERT_EQ(shm.dequeue().id_, static_cast<int>(i));
+    EXPECT_TRUE(shm.empty());
+}
+
+TEST_F(PosixSharedMemoryTest, AttachReadsCapacityFromHeader) 
+{
+    PosixSharedMemory owner("/test_shm", 1024, QueueMode::LOCK_FREE);
+    owner.create();
+
+    PosixSharedMemory other("/test_shm");
+    other.attach();
+    EXPECT_EQ(other.capacity(), 1024);
+
+    for (int round = 0; round < 3; ++round) 
+    {
+        for (int i = 0; i < 1024; ++i) 
+        {
+            SharedTask task{i, 0, "Task", TaskType::UNIX_TASK, false};
+            other.enqueue(task);
+        }
+        for (int i = 0; i < 1024; ++i) 
+            ASSERT_EQ(owner.dequeue().id_, i);
+    }
+    other.detach();
+}
+
+TEST_F(PosixSharedMemoryTest, BulkEnqueueDequeue) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 8, mode);
+        shm.create();
+
+        std::vector<SharedTask> tasks;
+        for (int i = 0; i < 6; ++i) 
+            tasks.push_back(SharedTask{i, i, "Task", TaskType::UNIX_TASK, false});
+
+        shm.enqueue_bulk(tasks);
+        EXPECT_EQ(shm.size(), 6);
+
+        std::vector<SharedTask> out(8);
+        EXPECT_EQ(shm.dequeue_bulk(out, 4), 4);
+        for (int i = 0; i < 4; ++i) 
+            EXPECT_EQ(out[i].id_, i);
+
+        shm.enqueue_bulk(tasks);
+        EXPECT_EQ(shm.size(), 8);
+
+        EXPECT_EQ(shm.dequeue_bulk(out, out.size()), 8);
+        EXPECT_EQ(out[0].id_, 4);
+        EXPECT_EQ(out[1].id_, 5);
+        EXPECT_EQ(out[2].id_, 0);
+        EXPECT_TRUE(shm.empty());
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, BulkEnqueueLargerThanCapacity) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 16, mode);
+        shm.create();
+
+        const int total = 1000;
+        std::vector<SharedTask> tasks;
+        for (int i = 0; i < total; ++i) 
+            tasks.push_back(SharedTask{i, 0, "Task", TaskType::UNIX_TASK, false});
+
+        std::thread producer([&shm, &tasks]() { shm.enqueue_bulk(tasks); });
+
+        std::vector<SharedTask> out(7);
+        int expected = 0;
+        while (expected < total) 
+        {
+            size_t taken = shm.dequeue_bulk(out, out.size());
+            for (size_t i = 0; i < taken; ++i) 
+                ASSERT_EQ(out[i].id_, expected++);
+        }
+
+        producer.join();
+        EXPECT_TRUE(shm.empty());
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, TryDequeueAndTimedDequeue) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 4, mode);
+        shm.create();
+
+        EXPECT_FALSE(shm.try_dequeue().has_value());
+
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_FALSE(shm.dequeue_for(std::chrono::milliseconds(50)).has_value());
+        EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+        SharedTask task{1, 0, "Task", TaskType::UNIX_TASK, false};
+        shm.enqueue(task);
+        auto dequeued = shm.try_dequeue();
+        ASSERT_TRUE(dequeued.has_value());
+        EXPECT_EQ(dequeued->id_, 1);
+
+        std::thread producer([&shm]() 
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            SharedTask late{2, 0, "Task", TaskType::UNIX_TASK, false};
+            shm.enqueue(late);
+        });
+
+        start = std::chrono::steady_clock::now();
+        dequeued = shm.dequeue_for(std::chrono::seconds(5));
+        producer.join();
+        ASSERT_TRUE(dequeued.has_value());
+        EXPECT_EQ(dequeued->id_, 2);
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+        shm.destroy();
+    }
+}
+
+
+TEST_F(PosixSharedMemoryTest, DescriptionsAreInternedOutOfLine) 
+{
+    EXPECT_EQ(sizeof(PosixSharedMemory::Slot), CACHE_LINE / PosixSharedMemory::SLOTS_PER_LINE);
+    EXPECT_LT(sizeof(CompactTask) * 10, sizeof(SharedTask));
+    EXPECT_LT(PosixSharedMemory::segment_size(1024), 1024 * sizeof(SharedTask) / 3);
+
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 8, mode);
+        shm.create();
+
+        std::vector<SharedTask> tasks;
+        for (int id = 0; id < 8; ++id) 
+        {
+            SharedTask task{id, 0, "", TaskType::IO_BOUND_TASK, id % 2 == 0, {id}};
+            std::string description = id % 2 ? "odd" : "I/O-Bound Task: output.txt";
+            strncpy(task.description_, description.c_str(), MAX_PATH - 1);
+            tasks.push_back(task);
+        }
+        std::memset(tasks[7].description_, 'x', MAX_PATH - 1);
+
+        shm.enqueue_bulk(tasks);
+        for (const auto& expected : tasks) 
+        {
+            SharedTask task = shm.dequeue();
+            EXPECT_EQ(task.id_, expected.id_);
+            EXPECT_EQ(task.type_, TaskType::IO_BOUND_TASK);
+            EXPECT_EQ(task.completed_, expected.completed_);
+            EXPECT_EQ(task.progress_.remaining_work_, expected.progress_.remaining_work_);
+            EXPECT_STREQ(task.description_, expected.description_);
+        }
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, ProgressSurvivesTheSegment) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 4, mode);
+        shm.create();
+
+        SharedTask task{1, 0, "I/O-Bound Task: output.txt", TaskType::IO_BOUND_TASK, false, {7, 42.5f, 0.3f}};
+        shm.enqueue(task);
+
+        shm.for_each_slot([](const TaskView& view) { EXPECT_EQ(view.progress_.remaining_work_, 7); });
+
+        SharedTask restored = shm.dequeue();
+        EXPECT_EQ(restored.progress_.remaining_work_, 7);
+        EXPECT_FLOAT_EQ(restored.progress_.virtual_runtime_, 42.5f);
+        EXPECT_NEAR(restored.progress_.cpu_usage_, 0.3f, 1e-4f);
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, DeadlineSurvivesTheSegment) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 4, mode);
+        shm.create();
+
+        int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        SharedTask task{1, 0, "Task", TaskType::UNIX_TASK, false, {}, now_ms + 1500};
+        shm.enqueue(task);
+        shm.enqueue(SharedTask{2, 100000, "Task", TaskType::UNIX_TASK, false});
+
+        shm.for_each_slot([&](const TaskView& view) 
+        {
+            EXPECT_EQ(view.deadline_ms_, view.id_ == 1 ? now_ms + 1500 : NO_DEADLINE_MS);
+        });
+
+        EXPECT_EQ(shm.dequeue().deadline_ms_, now_ms + 1500);
+        SharedTask unlimited = shm.dequeue();
+        EXPECT_EQ(unlimited.deadline_ms_, NO_DEADLINE_MS);
+        EXPECT_EQ(unlimited.priority_, 100000);
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, DistinctDescriptionsFillTheQueue) 
+{
+    const size_t capacity = 1024;
+    ASSERT_GE(DescriptionTable::default_bytes(capacity), capacity * DescriptionTable::UNIT);
+
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", capacity, mode);
+        shm.create();
+
+        std::vector<SharedTask> tasks(capacity);
+        for (size_t id = 0; id < capacity; ++id) 
+        {
+            tasks[id].id_ = static_cast<int>(id);
+            snprintf(tasks[id].description_, MAX_PATH, "Task %zu", id);
+        }
+        shm.enqueue_bulk(tasks);
+        EXPECT_EQ(shm.size(), capacity);
+
+        EXPECT_STREQ(shm.dequeue().description_, "Task 0");
+        SharedTask reused{static_cast<int>(capacity), 0, "Task 1", TaskType::UNIX_TASK, false};
+        shm.enqueue(reused);
+        EXPECT_EQ(shm.size(), capacity);
+
+        std::vector<SharedTask> rest(capacity);
+        EXPECT_EQ(shm.try_dequeue_bulk(rest, rest.size()), capacity);
+        EXPECT_STREQ(rest[capacity - 2].description_, "Task 1023");
+        EXPECT_STREQ(rest[capacity - 1].description_, "Task 1");
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, LongDescriptionsWaitForArenaSpace) 
+{
+    const size_t capacity = 64;
+    const size_t count = 256;
+
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", capacity, mode);
+        shm.create();
+
+        std::vector<SharedTask> tasks(count);
+        for (size_t id = 0; id < count; ++id) 
+        {
+            tasks[id].id_ = static_cast<int>(id);
+            std::memset(tasks[id].description_, 'a' + id % 26, 200);
+            snprintf(tasks[id].description_ + 200, MAX_PATH - 200, "%zu", id);
+        }
+
+        std::thread producer([&] { shm.enqueue_bulk(tasks); });
+        for (const auto& expected : tasks) 
+        {
+            SharedTask task = shm.dequeue();
+            EXPECT_EQ(task.id_, expected.id_);
+            EXPECT_STREQ(task.description_, expected.description_);
+        }
+        producer.join();
+        EXPECT_TRUE(shm.empty());
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, ConcurrentInterningKeepsTextsIntact) 
+{
+    const size_t bytes = 4096;
+    std::vector<uint64_t> memory(DescriptionTable::footprint(bytes) / sizeof(uint64_t) + 1);
+    auto* table = reinterpret_cast<DescriptionTable*>(memory.data());
+    table->reset(bytes);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread) 
+    {
+        threads.emplace_back([table, thread]
+        {
+            for (int i = 0; i < 20000; ++i) 
+            {
+                SharedTask task{i, 0, "", TaskType::UNIX_TASK, false};
+                snprintf(task.description_, MAX_PATH, "%s %d", i % 2 ? "shared" : "own", i % 2 ? i % 8 : thread);
+                CompactTask compact;
+                if (!table->store(task, compact))
+                    continue;
+
+                SharedTask loaded;
+                table->load(compact, loaded);
+                EXPECT_STREQ(loaded.description_, task.description_);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(table->used(), 0);
+    EXPECT_TRUE(table->available(std::string(MAX_PATH - 1, 'x').c_str()));
+}
+
+
+TEST_F(PosixSharedMemoryTest, PersistentQueueSurvivesRestart) 
+{
+    const std::string path = "test_shm_queue.dat";
+    unlink(path.c_str());
+
+    {
+        PosixSharedMemory shm("/test_shm", path, 8);
+        shm.create();
+        EXPECT_TRUE(shm.is_persistent());
+
+        std::vector<SharedTask> tasks = {
+            {1, 1, "add", TaskType::UNIX_TASK, false, {100}},
+            {2, 2, "CPU-Intensive Task", TaskType::CPU_INTENSIVE_TASK, false, {200}},
+            {3, 3, "add", TaskType::UNIX_TASK, false, {300}},
+            {4, 4, "I/O-Bound Task: output.txt", TaskType::IO_BOUND_TASK, false, {400}}
+        };
+        shm.enqueue_bulk(tasks);
+        EXPECT_EQ(shm.dequeue().id_, 1);
+    }
+
+    int expected = 2;
+    for (SyncPolicy sync : {SyncPolicy::NONE, SyncPolicy::PERIODIC, SyncPolicy::PER_BATCH}) 
+    {
+        PosixSharedMemory shm("/test_shm", path, 8, sync);
+        shm.create();
+        ASSERT_EQ(shm.size(), 3);
+
+        SharedTask task = shm.dequeue();
+        EXPECT_EQ(task.id_, expected++);
+        EXPECT_EQ(task.progress_.remaining_work_, task.id_ * 100);
+
+        shm.enqueue(task);
+        EXPECT_EQ(shm.size(), 3);
+    }
+
+    {
+        PosixSharedMemory shm("/test_shm", path, 8);
+        shm.create();
+        std::vector<int> ids;
+        std::vector<std::string> descriptions;
+        while (auto task = shm.try_dequeue()) 
+        {
+            ids.push_back(task->id_);
+            descriptions.push_back(task->description_);
+        }
+        EXPECT_EQ(ids, (std::vector<int>{2, 3, 4}));
+        EXPECT_EQ(descriptions, (std::vector<std::string>{"CPU-Intensive Task", "add", "I/O-Bound Task: output.txt"}));
+    }
+
+    {
+        PosixSharedMemory shm("/test_shm", path, 16);
+        shm.create();
+        EXPECT_EQ(shm.size(), 0);
+    }
+    unlink(path.c_str());
+}
+
+
+TEST_F(PosixSharedMemoryTest, StatisticsPageCountsTraffic) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 4, mode);
+        shm.create();
+
+        std::vector<SharedTask> tasks = {
+            {1, 19, "Task", TaskType::UNIX_TASK, false},
+            {2, 19, "Task", TaskType::UNIX_TASK, false},
+            {3, -5, "Task", TaskType::UNIX_TASK, false}
+        };
+        shm.enqueue_bulk(tasks);
+        EXPECT_EQ(shm.dequeue().id_, 1);
+        shm.enqueue(SharedTask{4, 100, "Task", TaskType::UNIX_TASK, false});
+
+        QueueStatistics statistics = shm.statistics();
+        EXPECT_EQ(statistics.total_enqueued_, 4);
+        EXPECT_EQ(statistics.total_dequeued_, 1);
+        EXPECT_EQ(statistics.high_water_mark_, 3);
+        EXPECT_EQ(statistics.queued(19), 2);
+        EXPECT_EQ(statistics.queued(-5), 1);
+        EXPECT_EQ(statistics.enqueued_[QueueStatistics::level_of(MAX_PRIORITY)], 3);
+        EXPECT_EQ(statistics.dequeued_[QueueStatistics::level_of(MAX_PRIORITY)], 1);
+
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, StatisticsPageMeasuresWaitsWithoutQueueLock) 
+{
+    PosixSharedMemory owner("/test_shm", 1);
+    owner.create();
+
+    EXPECT_FALSE(owner.dequeue_for(std::chrono::milliseconds(20)).has_value());
+    EXPECT_GE(owner.statistics().consumer_idle_ns_, 10'000'000u);
+
+    owner.enqueue(SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    std::thread producer([&owner]() 
+    {
+        owner.enqueue(SharedTask{2, 0, "Task", TaskType::UNIX_TASK, false});
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(owner.dequeue().id_, 1);
+    producer.join();
+    EXPECT_GE(owner.statistics().producer_blocked_ns_, 10'000'000u);
+
+    sem_t* mutex = sem_open("/test_shm_mut", 0);
+    ASSERT_NE(mutex, SEM_FAILED);
+    ASSERT_EQ(sem_wait(mutex), 0);
+
+    PosixSharedMemory monitor("/test_shm", 1);
+    monitor.attach();
+    QueueStatistics statistics = monitor.statistics();
+    EXPECT_EQ(statistics.total_enqueued_, 2);
+    EXPECT_EQ(statistics.total_dequeued_, 1);
+    monitor.detach();
+
+    sem_post(mutex);
+    sem_close(mutex);
+}
+
+TEST_F(PosixSharedMemoryTest, StatisticsPageSurvivesWritersKilledMidUpdate) 
+{
+    void* memory = mmap(nullptr, sizeof(StatisticsPage), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(memory, MAP_FAILED);
+    auto* page = static_cast<StatisticsPage*>(memory);
+    page->reset();
+
+    std::vector<SharedTask> tasks(8, SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    for (int round = 0; round < 5; ++round) 
+    {
+        pid_t writer = fork();
+        ASSERT_NE(writer, -1);
+        if (writer == 0) 
+        {
+            while (true)
+                page->record_enqueue(tasks, tasks.size());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        kill(writer, SIGKILL);
+        waitpid(writer, nullptr, 0);
+
+        uint64_t enqueued = page->snapshot().total_enqueued_;
+        page->record_dequeue(std::span(tasks).first(1));
+        QueueStatistics statistics = page->snapshot();
+        EXPECT_GE(statistics.total_enqueued_, enqueued);
+        EXPECT_EQ(statistics.total_dequeued_, static_cast<uint64_t>(round + 1));
+    }
+    munmap(memory, sizeof(StatisticsPage));
+}
+
+TEST_F(PosixSharedMemoryTest, SnapshotAndVisitSeeFifoWindow) 
+{
+    for (QueueMode mode : {QueueMode::LOCKING, QueueMode::LOCK_FREE}) 
+    {
+        PosixSharedMemory shm("/test_shm", 4, mode);
+        shm.create();
+
+        for (int id = 1; id <= 3; ++id)
+            shm.enqueue(SharedTask{id, 0, "Task", TaskType::UNIX_TASK, false});
+        shm.dequeue();
+        shm.dequeue();
+        for (int id = 4; id <= 6; ++id)
+            shm.enqueue(SharedTask{id, 0, "Wrapped", TaskType::UNIX_TASK, false});
+
+        std::vector<int> visited;
+        shm.for_each_slot([&visited](const TaskView& task) { visited.push_back(task.id_); });
+        EXPECT_EQ(visited, (std::vector<int>{3, 4, 5, 6}));
+
+        std::vector<SharedTask> tasks(3);
+        ASSERT_EQ(shm.snapshot(tasks), 3);
+        EXPECT_EQ(tasks[0].id_, 3);
+        EXPECT_EQ(tasks[2].id_, 5);
+        EXPECT_STREQ(tasks[2].description_, "Wrapped");
+        EXPECT_EQ(shm.size(), 4);
+        shm.destroy();
+    }
+}
+
+TEST_F(PosixSharedMemoryTest, DoorbellWakesEpollConsumer) 
+{
+    const std::string socket_path = "/tmp/test_shm_doorbell.sock";
+
+    PosixSharedMemory producer("/test_shm", 8);
+    producer.create();
+    auto doorbell = std::make_shared<Doorbell>();
+    producer.set_doorbell(doorbell);
+    DoorbellServer server(doorbell, socket_path);
+
+    PosixSharedMemory consumer("/test_shm", 1);
+    consumer.attach();
+    auto received = Doorbell::receive(socket_path);
+
+    int epoll = epoll_create1(0);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    ASSERT_EQ(epoll_ctl(epoll, EPOLL_CTL_ADD, received->fd(), &event), 0);
+
+    producer.enqueue(SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    EXPECT_EQ(epoll_wait(epoll, &event, 1, 0), 0);
+    EXPECT_FALSE(consumer.arm_doorbell());
+    EXPECT_EQ(consumer.dequeue().id_, 1);
+
+    ASSERT_TRUE(consumer.arm_doorbell());
+    std::thread writer([&producer]() 
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        producer.enqueue(SharedTask{2, 0, "Task", TaskType::UNIX_TASK, false});
+        producer.enqueue(SharedTask{3, 0, "Task", TaskType::UNIX_TASK, false});
+    });
+    ASSERT_EQ(epoll_wait(epoll, &event, 1, 1000), 1);
+    writer.join();
+
+    EXPECT_EQ(received->drain(), 1);
+    EXPECT_EQ(received->drain(), 0);
+    EXPECT_EQ(consumer.dequeue().id_, 2);
+    EXPECT_EQ(consumer.dequeue().id_, 3);
+
+    close(epoll);
+    consumer.detach();
+}
\ No newline at end of file
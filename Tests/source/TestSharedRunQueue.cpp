@@ -0,0 +1,119 @@
+#include <PosixSharedRunQueue/PosixSharedRunQueue.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+class PosixSharedRunQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        sem_unlink("/test_runqueue_mut");
+        shm_unlink("/test_runqueue");
+    }
+
+    void TearDown() override
+    {
+        sem_unlink("/test_runqueue_mut");
+        shm_unlink("/test_runqueue");
+    }
+};
+
+TEST_F(PosixSharedRunQueueTest, DequeuesByLevelThenFifo)
+{
+    PosixSharedRunQueue queue("/test_runqueue", 16);
+    queue.create();
+    EXPECT_TRUE(queue.is_priority_ordered());
+
+    queue.enqueue(SharedTask{1, 0, "Task", TaskType::UNIX_TASK, false});
+    queue.enqueue(SharedTask{2, -20, "Task", TaskType::UNIX_TASK, false});
+    queue.enqueue(SharedTask{3, 19, "Task", TaskType::UNIX_TASK, false});
+    queue.enqueue(SharedTask{4, 0, "Task", TaskType::UNIX_TASK, false});
+    queue.enqueue(SharedTask{5, 19, "Task", TaskType::UNIX_TASK, false});
+    EXPECT_EQ(queue.size(), 5);
+
+    std::vector<int> order;
+    while (auto task = queue.try_dequeue())
+        order.push_back(task->id_);
+    EXPECT_EQ(order, (std::vector<int>{3, 5, 1, 4, 2}));
+}
+
+TEST_F(PosixSharedRunQueueTest, ClampsOutOfRangePriorities)
+{
+    EXPECT_EQ(PosixSharedRunQueue::level_of(100), 0);
+    EXPECT_EQ(PosixSharedRunQueue::level_of(MAX_PRIORITY), 0);
+    EXPECT_EQ(PosixSharedRunQueue::level_of(MIN_PRIORITY), PRIORITY_LEVELS - 1);
+    EXPECT_EQ(PosixSharedRunQueue::level_of(-100), PRIORITY_LEVELS - 1);
+
+    PosixSharedRunQueue queue("/test_runqueue", 4);
+    queue.create();
+    queue.enqueue(SharedTask{1, -100, "Task", TaskType::UNIX_TASK, false});
+    queue.enqueue(SharedTask{2, 100, "Task", TaskType::UNIX_TASK, false});
+
+    SharedTask first = queue.dequeue();
+    EXPECT_EQ(first.id_, 2);
+    EXPECT_EQ(first.priority_, 100);
+    EXPECT_EQ(queue.dequeue().id_, 1);
+}
+
+TEST_F(PosixSharedRunQueueTest, ReusesNodesAcrossLevels)
+{
+    PosixSharedRunQueue queue("/test_runqueue", 3);
+    queue.create();
+
+    for (int round = 0; round < 100; ++round)
+    {
+        std::vector<SharedTask> tasks = {
+            {round, round % 40 - 20, "Task", TaskType::UNIX_TASK, false},
+            {round + 1000, 19 - round % 40, "Task", TaskType::UNIX_TASK, false},
+            {round + 2000, round % 40 - 20, "Task", TaskType::UNIX_TASK, false}
+        };
+        queue.enqueue_bulk(tasks);
+        EXPECT_EQ(queue.size(), 3);
+
+        std::vector<SharedTask> received(3);
+        EXPECT_EQ(queue.try_dequeue_bulk(received, 3), 3);
+        int expected_first = tasks[1].priority_ > tasks[0].priority_ ? round + 1000 : round;
+        EXPECT_EQ(received[0].id_, expected_first);
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+TEST_F(PosixSharedRunQueueTest, BlockingProducerAndTimedConsumer)
+{
+    PosixSharedRunQueue queue("/test_runqueue", 2);
+    queue.create();
+
+    EXPECT_FALSE(queue.dequeue_for(std::chrono::milliseconds(10)).has_value());
+
+    std::thread producer([&queue]()
+    {
+        for (int id = 1; id <= 20; ++id)
+            queue.enqueue(SharedTask{id, id % 5, "Task", TaskType::UNIX_TASK, false});
+    });
+
+    int received = 0;
+    while (received < 20)
+        if (queue.dequeue_for(std::chrono::milliseconds(1000)))
+            ++received;
+    producer.join();
+
+    EXPECT_EQ(received, 20);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(PosixSharedRunQueueTest, AttachSharesQueue)
+{
+    PosixSharedRunQueue owner("/test_runqueue", 8);
+    owner.create();
+    owner.enqueue(SharedTask{1, 1, "Task", TaskType::UNIX_TASK, false});
+    owner.enqueue(SharedTask{2, 5, "Task", TaskType::UNIX_TASK, false});
+
+    PosixSharedRunQueue client("/test_runqueue", 1);
+    client.attach();
+    EXPECT_EQ(client.capacity(), 8);
+    EXPECT_EQ(client.dequeue().id_, 2);
+    client.detach();
+
+    EXPECT_EQ(owner.dequeue().id_, 1);
+}
\ No newline at end of file
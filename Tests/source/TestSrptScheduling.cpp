@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <PosixSharedMemory/PosixSharedMemory.hpp>
+#include <SrptScheduling/SrptScheduling.hpp>
+#include <TaskProcessor/TaskProcessor.hpp>
+#include <Tasks/Tasks.hpp>
+
+TEST(SrptSchedulingTest, PredictorKeepsAnAveragePerTypeAndOperation)
+{
+    RuntimePredictor predictor(0.25);
+    UnixTask add(1, "add");
+    UnixTask add_with_operands(2, "add 5 10");
+    UnixTask mul(3, "mul");
+    EXPECT_EQ(predictor.predict(add), std::chrono::milliseconds(SRPT_DEFAULT_PREDICTION_MS));
+
+    predictor.observe(add, std::chrono::milliseconds(8));
+    EXPECT_EQ(predictor.predict(add), std::chrono::milliseconds(8));
+    predictor.observe(add_with_operands, std::chrono::milliseconds(16));
+    EXPECT_EQ(predictor.predict(add), std::chrono::milliseconds(10));
+    EXPECT_EQ(predictor.predict(mul), std::chrono::milliseconds(SRPT_DEFAULT_PREDICTION_MS));
+    EXPECT_EQ(predictor.groups(), 1);
+
+    CpuIntensiveTask known(4, std::chrono::milliseconds(30));
+    predictor.observe(known, std::chrono::milliseconds(500));
+    EXPECT_EQ(predictor.predict(known), std::chrono::milliseconds(30));
+
+    EXPECT_THROW(RuntimePredictor(0.0), std::invalid_argument);
+}
+
+TEST(SrptSchedulingTest, RunsTheShortestPredictedTaskFirst)
+{
+    SrptScheduling srpt;
+    srpt.predictor().observe(UnixTask(0, "mul"), std::chrono::milliseconds(20));
+
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(50)));
+    srpt.enqueue(std::make_shared<UnixTask>(2, "mul"));
+    srpt.enqueue(std::make_shared<UnixTask>(3, "sub"));
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(4, std::chrono::milliseconds(10)));
+    EXPECT_EQ(srpt.runnable(), 4);
+
+    for (int id : {4, 2, 1, 3})
+        EXPECT_EQ(srpt.pick_next()->get_id(), id);
+    EXPECT_EQ(srpt.pick_next(), nullptr);
+}
+
+TEST(SrptSchedulingTest, PreemptedTasksKeepTheTimeTheyUsed)
+{
+    SrptScheduling srpt;
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(60)));
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(40)));
+
+    auto task = srpt.pick_next();
+    ASSERT_EQ(task->get_id(), 2);
+    ASSERT_FALSE(task->execute(std::chrono::milliseconds(30)));
+    srpt.task_ran(*task, std::chrono::milliseconds(30), false);
+    srpt.enqueue(task);
+
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(3, std::chrono::milliseconds(20)));
+    for (int id : {2, 3, 1})
+        EXPECT_EQ(srpt.pick_next()->get_id(), id);
+
+    srpt.predictor().observe(UnixTask(4, "mul"), std::chrono::milliseconds(40));
+    srpt.enqueue(std::make_shared<UnixTask>(5, "mul"));
+    task = srpt.pick_next();
+    srpt.task_ran(*task, std::chrono::milliseconds(30), false);
+    srpt.enqueue(task);
+    srpt.enqueue(std::make_shared<UnixTask>(6, "mul"));
+    for (int id : {5, 6})
+        EXPECT_EQ(srpt.pick_next()->get_id(), id);
+}
+
+TEST(SrptSchedulingTest, ResumedTasksArePredictedFromTheirRemainingWork)
+{
+    SrptScheduling srpt;
+    auto resumed = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(100));
+    TaskProgress progress;
+    resumed->save_progress(progress);
+    progress.remaining_work_ = 10;
+    resumed->restore_progress(progress);
+
+    EXPECT_EQ(srpt.predictor().predict(*resumed), std::chrono::milliseconds(10));
+    srpt.enqueue(std::make_shared<CpuIntensiveTask>(2, std::chrono::milliseconds(30)));
+    srpt.enqueue(resumed);
+    EXPECT_EQ(srpt.pick_next()->get_id(), 1);
+}
+
+TEST(SrptSchedulingTest, CompletedTasksTeachThePredictor)
+{
+    SrptScheduling srpt;
+    auto task = std::make_shared<UnixTask>(1, "add");
+    srpt.enqueue(task);
+    auto picked = srpt.pick_next();
+    srpt.task_ran(*picked, std::chrono::milliseconds(3), false);
+    srpt.enqueue(picked);
+    picked = srpt.pick_next();
+    srpt.task_ran(*picked, std::chrono::milliseconds(2), true);
+
+    EXPECT_EQ(srpt.predictor().predict(UnixTask(2, "add")), std::chrono::milliseconds(5));
+}
+
+TEST(SrptSchedulingTest, ProcessorTeachesThePredictor)
+{
+    auto shared_memory = std::make_shared<PosixSharedMemory>("/test_srpt_processor", 100);
+    try
+    {
+        shared_memory->create();
+    }
+    catch (...)
+    {
+        shared_memory->attach();
+    }
+    auto queue_manager = std::make_shared<TaskQueueManager>(shared_memory);
+    TaskProcessor processor(queue_manager, std::chrono::milliseconds(10));
+    auto srpt = std::make_shared<SrptScheduling>();
+    processor.set_algorithm(srpt);
+
+    queue_manager->add_task(std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(25)));
+    processor.start();
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (queue_manager->registered_count() != 0 && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    processor.stop();
+    shared_memory->destroy();
+
+    EXPECT_EQ(queue_manager->registered_count(), 0);
+    EXPECT_EQ(srpt->predictor().groups(), 1);
+}
\ No newline at end of file
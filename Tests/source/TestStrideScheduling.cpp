@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <StrideScheduling/StrideScheduling.hpp>
+
+#include <map>
+
+namespace
+{
+    std::shared_ptr<UnixTask> make_task(int id, int tickets)
+    {
+        auto task = std::make_shared<UnixTask>(id, "Tenant");
+        task->set_attribute(TICKETS_ATTRIBUTE, tickets);
+        return task;
+    }
+
+    /**
+     * @brief Runs every picked task for one 10 ms slice and requeues it.
+     *
+     * @return The number of slices each task id ran.
+     */
+    std::map<int, int> run(StrideScheduling& scheduling, int slices)
+    {
+        std::map<int, int> ran;
+        for (int slice = 0; slice < slices; ++slice)
+        {
+            auto task = scheduling.pick_next();
+            scheduling.task_ran(*task, std::chrono::milliseconds(10), false);
+            ++ran[task->get_id()];
+            scheduling.enqueue(task);
+        }
+        return ran;
+    }
+}
+
+TEST(StrideSchedulingTest, TicketsComeFromTheAttributeOrTheNiceValue)
+{
+    UnixTask task(1, "Tenant", -20);
+    EXPECT_EQ(StrideScheduling::tickets_of(task), 40);
+    task.set_static_priority(19);
+    EXPECT_EQ(StrideScheduling::tickets_of(task), 1);
+    task.set_static_priority(0);
+    EXPECT_EQ(StrideScheduling::tickets_of(task), 20);
+
+    task.set_attribute(TICKETS_ATTRIBUTE, 300);
+    EXPECT_EQ(StrideScheduling::tickets_of(task), 300);
+    task.set_attribute(TICKETS_ATTRIBUTE, 0);
+    EXPECT_EQ(StrideScheduling::tickets_of(task), 20);
+}
+
+TEST(StrideSchedulingTest, StrideSharesTheCpuExactlyByTickets)
+{
+    StrideScheduling stride;
+    for (int id = 1; id <= 3; ++id)
+        stride.enqueue(make_task(id, id * 100));
+    EXPECT_EQ(stride.total_tickets(), 600);
+
+    for (int window = 1; window <= 10; ++window)
+    {
+        auto ran = run(stride, 60);
+        for (int id = 1; id <= 3; ++id)
+            EXPECT_NEAR(ran[id], id * 10, 1) << "window " << window << ", task " << id;
+    }
+}
+
+TEST(StrideSchedulingTest, NewTasksStartAtTheGlobalPass)
+{
+    StrideScheduling stride;
+    stride.enqueue(make_task(1, 100));
+    run(stride, 100);
+
+    stride.enqueue(make_task(2, 100));
+    auto ran = run(stride, 100);
+    EXPECT_NEAR(ran[1], 50, 1);
+    EXPECT_NEAR(ran[2], 50, 1);
+}
+
+TEST(StrideSchedulingTest, CompletedTasksLeaveTheRunQueue)
+{
+    StrideScheduling stride;
+    stride.enqueue(make_task(1, 100));
+    stride.enqueue(make_task(2, 100));
+
+    auto task = stride.pick_next();
+    stride.task_ran(*task, std::chrono::milliseconds(10), true);
+    EXPECT_EQ(stride.runnable(), 1);
+    EXPECT_EQ(stride.total_tickets(), 100);
+    EXPECT_NE(stride.pick_next()->get_id(), task->get_id());
+    EXPECT_EQ(stride.pick_next(), nullptr);
+}
+
+TEST(StrideSchedulingTest, LotteryConvergesToTicketShares)
+{
+    StrideScheduling lottery(StrideMode::LOTTERY, 42);
+    EXPECT_EQ(lottery.get_name(), LOTTERY_SCHEDULING);
+    for (int id = 1; id <= 3; ++id)
+        lottery.enqueue(make_task(id, id * 100));
+
+    const int slices = 60000;
+    auto ran = run(lottery, slices);
+    for (int id = 1; id <= 3; ++id)
+        EXPECT_NEAR(static_cast<double>(ran[id]) / slices, id / 6.0, 0.01);
+}
\ No newline at end of file
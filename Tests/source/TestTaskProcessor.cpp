@@ -69,4 +69,32 @@ TEST_F(TaskProcessorTest, ReenqueueIncompleteTask)
     EXPECT_EQ(queue_manager_->task_count(), 0);
 
     processor_->stop();
+}
+
+TEST_F(TaskProcessorTest, PicksUpTaskWithoutPolling) 
+{
+    processor_->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    auto task = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(5));
+    queue_manager_->add_task(task);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    EXPECT_EQ(queue_manager_->task_count(), 0);
+
+    processor_->stop();
+}
+
+
+TEST_F(TaskProcessorTest, StopKeepsThePreemptedTask) 
+{
+    auto task = std::make_shared<CpuIntensiveTask>(1, std::chrono::milliseconds(600));
+    queue_manager_->add_task(task);
+
+    processor_->start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    processor_->stop();
+
+    EXPECT_EQ(queue_manager_->task_count(), 1);
+    EXPECT_EQ(queue_manager_->registered_count(), 1);
 }
\ No newline at end of file